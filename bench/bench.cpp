@@ -0,0 +1,1062 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    bench.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Benchmark suite of the reader.
+ *
+ * Usage: SPFR_bench [--json FILE] [--max-keys N]
+ *
+ * This program generates configuration files from 10 up to 10^6 parameters with a mix of numbers, booleans, paths,
+ * long arrays and comments. For every load mode and size it measures the load time, the heap allocations, the peak
+ * heap and the peak resident memory, and the latency of single lookups as p50 and p99. Then it measures the array
+ * conversion throughput, the read throughput with and without statistics and the load time of a big file from one
+ * thread up to one thread per core, the reload of the big file after an edit of one line and the lookup with the
+ * perfect hash of a schema against the key index, the heap per parameter which a loaded reader keeps, and the load of
+ * the struct generated from test.config against a binding of the same fields. The tables go to the standard output,
+ * the same results are written as JSON to the given file ("-" for the standard output), so they can be compared
+ * between versions.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+#include <new>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <experimental/filesystem>
+
+#include "configImage.hpp"
+#include "readConfig.hpp"
+#include "testStruct.hpp"
+
+
+// Count the heap allocations and the heap in use, so the benchmark can show what a load needs.
+static std::atomic<long long> allocation_count(0);
+static std::atomic<long long> heap_in_use(0);
+static std::atomic<long long> heap_peak(0);
+
+void *count_allocation(void *memory)
+{
+    if (memory == nullptr) throw std::bad_alloc();
+
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    long long in_use = heap_in_use.fetch_add(malloc_usable_size(memory), std::memory_order_relaxed) +
+                       static_cast<long long>(malloc_usable_size(memory));
+    long long peak = heap_peak.load(std::memory_order_relaxed);
+
+    while (in_use > peak && !heap_peak.compare_exchange_weak(peak, in_use, std::memory_order_relaxed))
+    {
+    }
+
+    return memory;
+}
+
+void *operator new(std::size_t size)
+{
+    return count_allocation(std::malloc(size == 0 ? 1 : size));
+}
+
+// The blocks of the arenas come from the aligned operator new of the default memory resource.
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    void *memory = nullptr;
+
+    if (posix_memalign(&memory, std::max(sizeof(void *), static_cast<std::size_t>(alignment)), size == 0 ? 1 : size))
+    {
+        memory = nullptr;
+    }
+
+    return count_allocation(memory);
+}
+
+void operator delete(void *memory) noexcept
+{
+    if (memory == nullptr) return;
+
+    heap_in_use.fetch_sub(malloc_usable_size(memory), std::memory_order_relaxed);
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+namespace
+{
+
+// ------------------------------------------------ Synthetic configs -------------------------------------------------
+
+enum class ValueType { Int, Float, Bool, Path, IntArray, FloatArray };
+
+struct Parameter
+{
+    std::string name;
+    ValueType type;
+    int size;                                   // Number of fields of an array.
+};
+
+std::string key_name(int i)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "parameter_key_%07d", i);
+
+    return name;
+}
+
+// Writes a configuration with key_count parameters. The type of a parameter depends only on its number, so every
+// run of the benchmark reads the same files.
+std::string write_config(int key_count, std::vector<Parameter> &parameters, std::uintmax_t &file_size)
+{
+    std::experimental::filesystem::path path = std::experimental::filesystem::temp_directory_path();
+    path /= "spfr_bench_" + std::to_string(key_count) + ".config";
+
+    std::ofstream file(path.string());
+    std::mt19937 random(static_cast<unsigned>(key_count));
+
+    parameters.clear();
+    file << "# Synthetic configuration of the SPFR benchmark with " << key_count << " parameters.\n";
+
+    for (int i = 0; i < key_count; i++)
+    {
+        Parameter parameter{key_name(i), ValueType::Int, 1};
+
+        switch (i % 8)
+        {
+            case 0: case 1: case 2:
+                file << parameter.name << ": " << static_cast<int>(random() % 2000001) - 1000000;
+                break;
+
+            case 3:
+                parameter.type = ValueType::Float;
+                file << parameter.name << ": " << (static_cast<int>(random() % 200001) - 100000) * 0.03125f;
+                break;
+
+            case 4:
+                parameter.type = ValueType::Bool;
+                file << parameter.name << ": " << ((random() & 1) ? "true" : "0");
+                break;
+
+            case 5:
+                parameter.type = ValueType::Path;
+                file << parameter.name << ": /srv/data/set_" << random() % 1000 << "/file_" << i << ".bin";
+                break;
+
+            default:
+                // Long arrays, every hundredth one with a thousand fields.
+                parameter.type = (i % 8 == 6) ? ValueType::IntArray : ValueType::FloatArray;
+                parameter.size = (i % 100 == 6) ? 1000 : 16 + static_cast<int>(random() % 48);
+                file << parameter.name << ": [";
+
+                for (int field = 0; field < parameter.size; field++)
+                {
+                    if (field > 0) file << ", ";
+
+                    if (parameter.type == ValueType::IntArray) file << static_cast<int>(random() % 100000);
+                    else file << static_cast<int>(random() % 100000) * 0.25f;
+                }
+
+                file << "]";
+                break;
+        }
+
+        if (i % 4 == 0) file << "    # Comment behind the value.";
+
+        file << '\n';
+
+        if (i % 16 == 15) file << "# Comment line between the parameters.\n";
+
+        parameters.push_back(parameter);
+    }
+
+    file.close();
+    file_size = std::experimental::filesystem::file_size(path);
+
+    return path.string();
+}
+
+// ------------------------------------------------ Measurement helpers -----------------------------------------------
+
+using Clock = std::chrono::steady_clock;
+
+double nanoseconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+long status_kb(const char *field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    std::size_t length = std::strlen(field);
+
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, length, field) == 0) return std::stol(line.substr(length));
+    }
+
+    return 0;
+}
+
+// Sets the peak resident memory back to the current one, so the peak of one run can be measured. Freed heap of the
+// previous runs is given back first, otherwise it would count for every later run.
+void reset_peak_memory()
+{
+    malloc_trim(0);
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+double percentile(std::vector<double> &values, double fraction)
+{
+    if (values.empty()) return 0.0;
+
+    std::size_t index = static_cast<std::size_t>(fraction * (values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+
+    return values[index];
+}
+
+// Median cost of reading the clock, which is part of every single lookup time.
+double clock_overhead()
+{
+    std::vector<double> samples;
+
+    for (int i = 0; i < 10001; i++)
+    {
+        Clock::time_point start = Clock::now();
+        samples.push_back(nanoseconds(start, Clock::now()));
+    }
+
+    return percentile(samples, 0.5);
+}
+
+// Reads one parameter with the getter of its type. Name is a std::string or a SPFR::ConfigKey.
+template <typename Name>
+long long read_parameter(const SPFR::ReadConfig &read_config, const Name &name, const Parameter &parameter,
+                         std::vector<int> &int_fields, std::vector<float> &float_fields)
+{
+    int int_value = 0;
+    float float_value = 0.0f;
+    bool bool_value = false;
+    std::string path;
+
+    switch (parameter.type)
+    {
+        case ValueType::Int:
+            read_config.get_parameter(name, int_value);
+            return int_value;
+
+        case ValueType::Float:
+            read_config.get_parameter(name, float_value);
+            return static_cast<long long>(float_value);
+
+        case ValueType::Bool:
+            read_config.get_parameter(name, bool_value);
+            return bool_value;
+
+        case ValueType::Path:
+            read_config.get_parameter(name, path);
+            return static_cast<long long>(path.size());
+
+        case ValueType::IntArray:
+            int_fields.resize(parameter.size);
+            read_config.get_parameter(name, int_fields.data(), parameter.size);
+            return int_fields[0];
+
+        case ValueType::FloatArray:
+            float_fields.resize(parameter.size);
+            read_config.get_parameter(name, float_fields.data(), parameter.size);
+            return static_cast<long long>(float_fields[0]);
+    }
+
+    return 0;
+}
+
+// ------------------------------------------------------ Results -----------------------------------------------------
+
+struct LoadResult
+{
+    const char *mode;
+    int keys;
+    std::uintmax_t file_bytes;
+    double load_ms;
+    long long load_allocations;
+    long long peak_heap_kb;
+    long peak_rss_kb;
+    double lookup_p50_ns;
+    double lookup_p99_ns;
+    double key_lookup_p50_ns;
+    double key_lookup_p99_ns;
+};
+
+struct ArrayResult
+{
+    const char *type;
+    std::size_t fields;
+    double mb_per_s;
+};
+
+struct ThreadResult
+{
+    unsigned threads;
+    double mlookups_per_s;
+    double mlookups_per_s_stats;            // With the statistics switched on.
+};
+
+struct ParallelLoadResult
+{
+    unsigned threads;
+    double load_ms;
+};
+
+struct ReloadResult
+{
+    const char *mode;
+    double reload_ms;
+};
+
+struct SchemaResult
+{
+    const char *index;
+    int keys;
+    double load_ms;
+    double find_ns;                         // Only the index, from the hash of the key to the position.
+    double read_ns;                         // A get_parameter call with a ConfigKey.
+};
+
+struct StorageResult
+{
+    const char *mode;
+    int keys;
+    double heap_bytes;                      // Heap per parameter which the loaded reader keeps.
+    double text_bytes;                      // Bytes of the name and the value without spaces per parameter.
+};
+
+struct StructResult
+{
+    const char *reader;
+    double load_us;                         // Load of the file and all of its parameters.
+    long long allocations;
+};
+
+// ------------------------------------------------------ Suites ------------------------------------------------------
+
+bool run_load(const char *mode, int key_count, SPFR::ReadOptions options, LoadResult &result)
+{
+    std::vector<Parameter> parameters;
+    std::uintmax_t file_size = 0;
+    std::string file_name = write_config(key_count, parameters, file_size);
+
+    // The buffered mode refuses files over 1 MB.
+    if (options.load_mode == SPFR::LoadMode::Buffered && file_size > 1048576)
+    {
+        std::experimental::filesystem::remove(file_name);
+        return false;
+    }
+
+    // The compiled mode reads the image of the file, which is built before the measurement like on a deployment.
+    if (options.load_mode == SPFR::LoadMode::Compiled)
+    {
+        std::string error;
+        std::string image_name = file_name + ".spfr";
+
+        if (!SPFR::ConfigImage::compile(file_name, image_name, error)) std::printf("%s\n", error.c_str());
+
+        std::experimental::filesystem::remove(file_name);
+        file_name = image_name;
+    }
+
+    // Random sample of the parameters, read in random order. Keys are hashed before, as constexpr keys are.
+    std::mt19937 random(7);
+    std::vector<std::size_t> sample;
+    std::vector<SPFR::ConfigKey> keys;
+
+    for (int i = 0; i < std::min(key_count * 4, 200000); i++) sample.push_back(random() % parameters.size());
+    for (const Parameter &parameter : parameters) keys.emplace_back(parameter.name);
+
+    std::vector<int> int_fields(1000);
+    std::vector<float> float_fields(1000);
+    std::vector<double> lookup_times(sample.size());
+    std::vector<double> key_lookup_times(sample.size());
+    long long checksum = 0;
+
+    reset_peak_memory();
+    heap_peak = heap_in_use.load();
+
+    long long heap_before = heap_in_use.load();
+    long long allocations_before = allocation_count.load();
+    Clock::time_point load_start = Clock::now();
+    {
+        SPFR::ReadConfig read_config(file_name, options);
+        Clock::time_point load_end = Clock::now();
+        long long load_allocations = allocation_count.load() - allocations_before;
+
+        // The first read of a value converts it. The percentiles are taken from the converted values.
+        for (std::size_t index : sample)
+        {
+            checksum += read_parameter(read_config, parameters[index].name, parameters[index], int_fields,
+                                       float_fields);
+        }
+
+        for (std::size_t i = 0; i < sample.size(); i++)
+        {
+            const Parameter &parameter = parameters[sample[i]];
+            Clock::time_point start = Clock::now();
+            checksum += read_parameter(read_config, parameter.name, parameter, int_fields, float_fields);
+            lookup_times[i] = nanoseconds(start, Clock::now());
+        }
+
+        for (std::size_t i = 0; i < sample.size(); i++)
+        {
+            const Parameter &parameter = parameters[sample[i]];
+            Clock::time_point start = Clock::now();
+            checksum += read_parameter(read_config, keys[sample[i]], parameter, int_fields, float_fields);
+            key_lookup_times[i] = nanoseconds(start, Clock::now());
+        }
+
+        result = LoadResult{mode, key_count, file_size, nanoseconds(load_start, load_end) / 1e6, load_allocations,
+                            (heap_peak.load() - heap_before) / 1024, status_kb("VmHWM:"),
+                            percentile(lookup_times, 0.5), percentile(lookup_times, 0.99),
+                            percentile(key_lookup_times, 0.5), percentile(key_lookup_times, 0.99)};
+    }
+
+    if (checksum == 0) std::printf("Lookup returned no values.\n");
+
+    std::experimental::filesystem::remove(file_name);
+
+    return true;
+}
+
+// Parses one array with one million fields several times and returns the throughput of the conversion.
+template <typename T>
+ArrayResult run_array(const char *type, const std::string &text)
+{
+    std::vector<T> values;
+    const int rounds = 5;
+
+    Clock::time_point start = Clock::now();
+
+    for (int round = 0; round < rounds; round++) SPFR::parse_value(text, values);
+
+    double seconds = nanoseconds(start, Clock::now()) / 1e9 / rounds;
+
+    return ArrayResult{type, values.size(), text.size() / seconds / 1e6};
+}
+
+// Reads all parameters of one file from 1 up to one thread per core and returns the total read throughput.
+std::vector<ThreadResult> run_threads(int key_count, SPFR::ReadOptions options)
+{
+    std::vector<Parameter> parameters;
+    std::uintmax_t file_size = 0;
+    std::string file_name = write_config(key_count, parameters, file_size);
+
+    const SPFR::ReadConfig read_config(file_name, options);
+    const int rounds = 20;
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<ThreadResult> results;
+
+    for (unsigned thread_count = 1; ; thread_count = std::min(thread_count * 2, max_threads))
+    {
+        std::atomic<bool> go(false);
+        std::atomic<long long> checksum(0);
+        std::vector<std::thread> threads;
+
+        for (unsigned t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back([&, t]()
+            {
+                std::vector<int> int_fields(1000);
+                std::vector<float> float_fields(1000);
+                long long sum = 0;
+
+                while (!go.load()) std::this_thread::yield();
+
+                // Every thread starts at another key, so the threads don't walk the file in lockstep.
+                for (int round = 0; round < rounds; round++)
+                {
+                    for (int i = 0; i < key_count; i++)
+                    {
+                        const Parameter &parameter = parameters[(i + t * 7919) % key_count];
+                        sum += read_parameter(read_config, parameter.name, parameter, int_fields, float_fields);
+                    }
+                }
+
+                checksum += sum;
+            });
+        }
+
+        Clock::time_point start = Clock::now();
+        go = true;
+
+        for (std::thread &thread : threads) thread.join();
+
+        double lookups = static_cast<double>(rounds) * key_count * thread_count;
+
+        results.push_back(ThreadResult{thread_count, lookups / (nanoseconds(start, Clock::now()) / 1e3), 0});
+
+        if (checksum.load() == 0) std::printf("Lookup returned no values.\n");
+
+        if (thread_count == max_threads) break;
+    }
+
+    std::experimental::filesystem::remove(file_name);
+
+    return results;
+}
+
+// Loads one big file with 1 up to one parse thread per core and returns the load times.
+std::vector<ParallelLoadResult> run_parallel_load(int key_count, SPFR::ReadOptions options)
+{
+    std::vector<Parameter> parameters;
+    std::uintmax_t file_size = 0;
+    std::string file_name = write_config(key_count, parameters, file_size);
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<ParallelLoadResult> results;
+
+    for (unsigned thread_count = 1; ; thread_count = std::min(thread_count * 2, max_threads))
+    {
+        options.parse_threads = thread_count;
+
+        Clock::time_point start = Clock::now();
+        {
+            SPFR::ReadConfig read_config(file_name, options);
+            results.push_back(ParallelLoadResult{thread_count, nanoseconds(start, Clock::now()) / 1e6});
+        }
+
+        if (thread_count == max_threads) break;
+    }
+
+    std::experimental::filesystem::remove(file_name);
+
+    return results;
+}
+
+// Changes the value of one parameter in the middle of a big file and measures the reload with and without the
+// incremental reload.
+std::vector<ReloadResult> run_reload(int key_count, SPFR::ReadOptions options)
+{
+    std::vector<Parameter> parameters;
+    std::uintmax_t file_size = 0;
+    std::string file_name = write_config(key_count, parameters, file_size);
+    std::vector<ReloadResult> results;
+
+    std::ifstream file(file_name, std::ios::binary);
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::size_t edit = text.find(key_name(key_count / 2) + ": ");
+
+    for (bool incremental : {false, true})
+    {
+        options.incremental_reload = incremental;
+
+        std::ofstream(file_name, std::ios::binary) << text;
+        SPFR::ReadConfig read_config(file_name, options);
+
+        // The new value is longer, so the file has another size even on file systems with coarse time stamps.
+        std::string edited = text;
+        edited.insert(edit + key_name(key_count / 2).size() + 2, "1");
+        std::ofstream(file_name, std::ios::binary) << edited;
+
+        Clock::time_point start = Clock::now();
+        read_config.reload();
+        results.push_back(ReloadResult{incremental ? "incremental" : "full", nanoseconds(start, Clock::now()) / 1e6});
+    }
+
+    std::experimental::filesystem::remove(file_name);
+
+    return results;
+}
+
+// Compares the key index with the perfect hash of a schema of all parameters, first the bare indexes and then the
+// reads of all parameters. The load with the schema also checks and converts every value.
+std::vector<SchemaResult> run_schema(int key_count, SPFR::ReadOptions options)
+{
+    std::vector<Parameter> parameters;
+    std::uintmax_t file_size = 0;
+    std::string file_name = write_config(key_count, parameters, file_size);
+
+    const SPFR::ParameterType types[] = {SPFR::ParameterType::Int, SPFR::ParameterType::Float,
+                                         SPFR::ParameterType::Bool, SPFR::ParameterType::String,
+                                         SPFR::ParameterType::IntArray, SPFR::ParameterType::FloatArray};
+    std::vector<SPFR::ConfigSchema::Field> fields;
+    std::vector<SPFR::ConfigKey> keys;
+    SPFR::KeyIndex key_index;
+    std::string error;
+
+    for (const Parameter &parameter : parameters)
+    {
+        fields.push_back(SPFR::ConfigSchema::Field{parameter.name, types[static_cast<int>(parameter.type)]});
+    }
+
+    // The keys are created after the fields, so their names stay in place.
+    for (std::uint32_t i = 0; i < fields.size(); i++)
+    {
+        keys.emplace_back(fields[i].name);
+        key_index.insert(keys[i].name(), keys[i].hash(), i);
+    }
+
+    auto schema = std::make_shared<SPFR::ConfigSchema>();
+
+    if (!schema->assign(fields, error)) std::printf("%s\n", error.c_str());
+
+    // Random order, so the caches don't profit from the order of the file.
+    std::mt19937 random(11);
+    std::vector<std::uint32_t> sample(std::max(key_count, 1000000));
+
+    for (std::uint32_t &index : sample) index = random() % key_count;
+
+    std::vector<SchemaResult> results;
+
+    for (bool with_schema : {false, true})
+    {
+        long long checksum = 0;
+        Clock::time_point start = Clock::now();
+
+        if (with_schema)
+        {
+            for (std::uint32_t index : sample) checksum += schema->find(keys[index]);
+        }
+        else
+        {
+            for (std::uint32_t index : sample) checksum += key_index.find(keys[index].name(), keys[index].hash());
+        }
+
+        double find_ns = nanoseconds(start, Clock::now()) / sample.size();
+
+        options.schema = with_schema ? schema : nullptr;
+
+        start = Clock::now();
+        SPFR::ReadConfig read_config(file_name, options);
+        double load_ms = nanoseconds(start, Clock::now()) / 1e6;
+
+        std::vector<int> int_fields(1000);
+        std::vector<float> float_fields(1000);
+
+        // The first read converts the values without the schema, so both are measured with converted values.
+        for (int i = 0; i < key_count; i++)
+        {
+            checksum += read_parameter(read_config, keys[i], parameters[i], int_fields, float_fields);
+        }
+
+        start = Clock::now();
+
+        for (std::uint32_t index : sample)
+        {
+            checksum += read_parameter(read_config, keys[index], parameters[index], int_fields, float_fields);
+        }
+
+        results.push_back(SchemaResult{with_schema ? "schema" : "key index", key_count, load_ms, find_ns,
+                                       nanoseconds(start, Clock::now()) / sample.size()});
+
+        if (checksum == 0) std::printf("Lookup returned no values.\n");
+    }
+
+    std::experimental::filesystem::remove(file_name);
+
+    return results;
+}
+
+// Measures the heap which a reader keeps after the load, before any value is converted.
+StorageResult run_storage(const char *mode, int key_count, SPFR::ReadOptions options)
+{
+    std::vector<Parameter> parameters;
+    std::uintmax_t file_size = 0;
+    std::string file_name = write_config(key_count, parameters, file_size);
+
+    // The names and values are what every mode has to keep in some form.
+    std::ifstream file(file_name);
+    std::string line;
+    std::size_t text_size = 0;
+
+    while (std::getline(file, line))
+    {
+        line = line.substr(0, line.find('#'));
+        text_size += line.size() - std::count(line.begin(), line.end(), ' ') -
+                     std::count(line.begin(), line.end(), ':');
+    }
+
+    long long heap_before = heap_in_use.load();
+    double heap_bytes;
+    {
+        SPFR::ReadConfig read_config(file_name, options);
+
+        heap_bytes = static_cast<double>(heap_in_use.load() - heap_before) / key_count;
+    }
+
+    std::experimental::filesystem::remove(file_name);
+
+    return StorageResult{mode, key_count, heap_bytes, static_cast<double>(text_size) / key_count};
+}
+
+// Loads example_config/test.config into the struct generated from its template and into the same fields with a
+// binding of the reader, which indexes the names and converts the values before they are copied.
+std::vector<StructResult> run_struct(SPFR::ReadOptions options)
+{
+    std::experimental::filesystem::path path = std::experimental::filesystem::temp_directory_path() /
+                                               "spfr_bench_struct.config";
+
+    std::ofstream(path.string()) << "string_example: /home/USERNAME/workspace/blubb       # Example for a comment\n"
+                                    "character: z\nnumber_int: 12\nnumber_float: 4234.234234\nnumber_bool: 1\n"
+                                    "word_bool: true\ncharacter_array: [a, b, c, d, e, f, g]\n"
+                                    "number_int_array: [3425,121,999999, 5555, 1234]\n"
+                                    "number_float_array: [2.234,3234.21314234,4.5]\n"
+                                    "string_array: {Hello, World, !}\n";
+
+    const int repetitions = 20000;
+    TestStruct fields;
+    SPFR::ConfigBinding binding;
+
+    binding.bind("string_example", fields.string_example);
+    binding.bind("character", fields.character);
+    binding.bind("number_int", fields.number_int);
+    binding.bind("number_float", fields.number_float);
+    binding.bind("number_bool", fields.number_bool);
+    binding.bind("word_bool", fields.word_bool);
+    binding.bind("character_array", fields.character_array.data(), 7);
+    binding.bind("number_int_array", fields.number_int_array.data(), 5);
+    binding.bind("number_float_array", fields.number_float_array.data(), 3);
+    binding.bind("string_array", fields.string_array.data(), 3);
+
+    std::vector<StructResult> results;
+
+    for (bool generated : {false, true})
+    {
+        std::size_t found = 0;
+        std::string error;
+        long long allocations = allocation_count.load();
+        Clock::time_point start = Clock::now();
+
+        for (int i = 0; i < repetitions; i++)
+        {
+            SPFR::BindSummary summary;
+
+            if (generated)
+            {
+                TestStruct loaded;
+
+                loaded.load(path.string(), summary, error);
+            }
+            else
+            {
+                SPFR::ReadConfig read_config(path.string(), options);
+
+                summary = read_config.resolve(binding);
+            }
+
+            found += summary.found;
+        }
+
+        results.push_back(StructResult{generated ? "generated" : "binding", nanoseconds(start, Clock::now()) /
+                                       repetitions / 1e3, (allocation_count.load() - allocations) / repetitions});
+
+        if (found != 10u * repetitions) std::printf("Only %zu of the parameters were found.\n", found);
+    }
+
+    std::experimental::filesystem::remove(path);
+
+    return results;
+}
+
+// ------------------------------------------------------ Output ------------------------------------------------------
+
+std::string to_json(double clock_ns, const std::vector<LoadResult> &loads, const std::vector<ArrayResult> &arrays,
+                    const std::vector<ThreadResult> &threads, const std::vector<ParallelLoadResult> &parallel_loads,
+                    const std::vector<ReloadResult> &reloads, const std::vector<SchemaResult> &schemas,
+                    const std::vector<StorageResult> &storages, const std::vector<StructResult> &structs)
+{
+    std::ostringstream json;
+
+    json << "{\n  \"benchmark\": \"SPFR_bench\",\n  \"format\": 1,\n";
+    json << "  \"cores\": " << std::max(1u, std::thread::hardware_concurrency()) << ",\n";
+    json << "  \"clock_overhead_ns\": " << clock_ns << ",\n  \"loads\": [";
+
+    for (std::size_t i = 0; i < loads.size(); i++)
+    {
+        const LoadResult &r = loads[i];
+
+        json << (i ? "," : "") << "\n    {\"mode\": \"" << r.mode << "\", \"keys\": " << r.keys
+             << ", \"file_bytes\": " << r.file_bytes << ", \"load_ms\": " << r.load_ms
+             << ", \"load_allocations\": " << r.load_allocations << ", \"peak_heap_kb\": " << r.peak_heap_kb
+             << ", \"peak_rss_kb\": " << r.peak_rss_kb << ", \"lookup_p50_ns\": " << r.lookup_p50_ns
+             << ", \"lookup_p99_ns\": " << r.lookup_p99_ns << ", \"key_lookup_p50_ns\": " << r.key_lookup_p50_ns
+             << ", \"key_lookup_p99_ns\": " << r.key_lookup_p99_ns << "}";
+    }
+
+    json << "\n  ],\n  \"arrays\": [";
+
+    for (std::size_t i = 0; i < arrays.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    {\"type\": \"" << arrays[i].type << "\", \"fields\": " << arrays[i].fields
+             << ", \"mb_per_s\": " << arrays[i].mb_per_s << "}";
+    }
+
+    json << "\n  ],\n  \"threads\": [";
+
+    for (std::size_t i = 0; i < threads.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    {\"threads\": " << threads[i].threads << ", \"mlookups_per_s\": "
+             << threads[i].mlookups_per_s << ", \"mlookups_per_s_stats\": " << threads[i].mlookups_per_s_stats << "}";
+    }
+
+    json << "\n  ],\n  \"parallel_loads\": [";
+
+    for (std::size_t i = 0; i < parallel_loads.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    {\"threads\": " << parallel_loads[i].threads << ", \"load_ms\": "
+             << parallel_loads[i].load_ms << "}";
+    }
+
+    json << "\n  ],\n  \"reloads\": [";
+
+    for (std::size_t i = 0; i < reloads.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    {\"mode\": \"" << reloads[i].mode << "\", \"reload_ms\": "
+             << reloads[i].reload_ms << "}";
+    }
+
+    json << "\n  ],\n  \"schemas\": [";
+
+    for (std::size_t i = 0; i < schemas.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    {\"index\": \"" << schemas[i].index << "\", \"keys\": " << schemas[i].keys
+             << ", \"load_ms\": " << schemas[i].load_ms << ", \"find_ns\": " << schemas[i].find_ns << ", \"read_ns\": "
+             << schemas[i].read_ns << "}";
+    }
+
+    json << "\n  ],\n  \"storages\": [";
+
+    for (std::size_t i = 0; i < storages.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    {\"mode\": \"" << storages[i].mode << "\", \"keys\": " << storages[i].keys
+             << ", \"heap_bytes\": " << storages[i].heap_bytes << ", \"text_bytes\": " << storages[i].text_bytes
+             << "}";
+    }
+
+    json << "\n  ],\n  \"structs\": [";
+
+    for (std::size_t i = 0; i < structs.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    {\"reader\": \"" << structs[i].reader << "\", \"load_us\": "
+             << structs[i].load_us << ", \"allocations\": " << structs[i].allocations << "}";
+    }
+
+    json << "\n  ]\n}\n";
+
+    return json.str();
+}
+
+}
+
+int main (int argc, char *argv[])
+{
+    std::string json_file;
+    int max_keys = 1000000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) json_file = argv[++i];
+        else if (std::strcmp(argv[i], "--max-keys") == 0 && i + 1 < argc) max_keys = std::atoi(argv[++i]);
+        else
+        {
+            std::fprintf(stderr, "Usage: %s [--json FILE] [--max-keys N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // With "--json -" only the JSON goes to the standard output.
+    FILE *table = (json_file == "-") ? stderr : stdout;
+
+    // The diagnostics are switched off, so only the load and the lookup are measured.
+    SPFR::ReadOptions buffered;
+    buffered.log_mode = SPFR::LogMode::Silent;
+
+    SPFR::ReadOptions mapped = buffered;
+    mapped.load_mode = SPFR::LoadMode::MemoryMapped;
+
+    SPFR::ReadOptions lazy = mapped;
+    lazy.lazy_values = true;
+
+    SPFR::ReadOptions compact = mapped;
+    compact.compact_storage = true;
+
+    SPFR::ReadOptions compiled = buffered;
+    compiled.load_mode = SPFR::LoadMode::Compiled;
+
+    double clock_ns = clock_overhead();
+    std::vector<LoadResult> loads;
+
+    std::fprintf(table, "Single lookups include the clock overhead of %.1f ns.\n", clock_ns);
+
+    for (const auto &mode : {std::make_pair("buffered", buffered), std::make_pair("mapped", mapped),
+                             std::make_pair("lazy", lazy), std::make_pair("compact", compact),
+                             std::make_pair("compiled", compiled)})
+    {
+        std::fprintf(table, "\n%s load\n%10s %12s %10s %10s %12s %12s %9s %9s %9s %9s\n", mode.first, "keys",
+                     "file [kB]", "load [ms]", "allocs", "heap [kB]", "rss [kB]", "p50 [ns]", "p99 [ns]",
+                     "key p50", "key p99");
+
+        for (int key_count = 10; key_count <= max_keys; key_count = key_count * 10)
+        {
+            LoadResult result;
+
+            if (!run_load(mode.first, key_count, mode.second, result))
+            {
+                std::fprintf(table, "%10d %12s\n", key_count, "over 1 MB");
+                continue;
+            }
+
+            std::fprintf(table, "%10d %12ju %10.3f %10lld %12lld %12ld %9.1f %9.1f %9.1f %9.1f\n", result.keys,
+                         result.file_bytes / 1024, result.load_ms, result.load_allocations, result.peak_heap_kb,
+                         result.peak_rss_kb, result.lookup_p50_ns, result.lookup_p99_ns, result.key_lookup_p50_ns,
+                         result.key_lookup_p99_ns);
+
+            loads.push_back(result);
+        }
+    }
+
+    std::string int_array = "[";
+    std::string float_array = "[";
+
+    for (int i = 0; i < 1000000; i++)
+    {
+        if (i > 0)
+        {
+            int_array += ", ";
+            float_array += ", ";
+        }
+
+        int_array += std::to_string((i * 7919LL) % 100000 - 50000);
+        float_array += std::to_string((i % 1000) * 0.125f - 60.0f);
+    }
+
+    int_array += "]";
+    float_array += "]";
+
+    std::vector<ArrayResult> arrays = {run_array<int>("int", int_array), run_array<float>("float", float_array)};
+
+    std::fprintf(table, "\nArray conversion\n%10s %12s %12s\n", "type", "fields", "[MB/s]");
+
+    for (const ArrayResult &result : arrays)
+    {
+        std::fprintf(table, "%10s %12zu %12.1f\n", result.type, result.fields, result.mb_per_s);
+    }
+
+    std::vector<ThreadResult> threads = run_threads(std::min(10000, max_keys), mapped);
+    SPFR::ReadOptions counted = mapped;
+    counted.collect_stats = true;
+    std::vector<ThreadResult> counted_threads = run_threads(std::min(10000, max_keys), counted);
+
+    for (std::size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].mlookups_per_s_stats = counted_threads[i].mlookups_per_s;
+    }
+
+    std::fprintf(table, "\nConcurrent lookup\n%10s %16s %10s %16s\n", "threads", "[Mlookups/s]", "speedup",
+                 "with stats");
+
+    for (const ThreadResult &result : threads)
+    {
+        std::fprintf(table, "%10u %16.2f %10.2f %16.2f\n", result.threads, result.mlookups_per_s,
+                     result.mlookups_per_s / threads[0].mlookups_per_s, result.mlookups_per_s_stats);
+    }
+
+    int parallel_key_count = std::min(1000000, max_keys);
+    std::vector<ParallelLoadResult> parallel_loads = run_parallel_load(parallel_key_count, mapped);
+
+    std::fprintf(table, "\nParallel mapped load of %d keys\n%10s %12s %10s\n", parallel_key_count, "threads",
+                 "load [ms]", "speedup");
+
+    for (const ParallelLoadResult &result : parallel_loads)
+    {
+        std::fprintf(table, "%10u %12.3f %10.2f\n", result.threads, result.load_ms,
+                     parallel_loads[0].load_ms / result.load_ms);
+    }
+
+    std::vector<ReloadResult> reloads = run_reload(parallel_key_count, mapped);
+
+    std::fprintf(table, "\nReload after an edit of one line of %d keys\n%12s %12s\n", parallel_key_count, "reload",
+                 "[ms]");
+
+    for (const ReloadResult &result : reloads) std::fprintf(table, "%12s %12.3f\n", result.mode, result.reload_ms);
+
+    std::vector<SchemaResult> schemas;
+
+    for (int key_count : {std::min(1000, max_keys), std::min(100000, max_keys)})
+    {
+        std::vector<SchemaResult> results = run_schema(key_count, mapped);
+        schemas.insert(schemas.end(), results.begin(), results.end());
+    }
+
+    std::fprintf(table, "\nLookup with and without a schema\n%12s %10s %12s %12s %12s\n", "index", "keys",
+                 "load [ms]", "find [ns]", "read [ns]");
+
+    for (const SchemaResult &result : schemas)
+    {
+        std::fprintf(table, "%12s %10d %12.3f %12.1f %12.1f\n", result.index, result.keys, result.load_ms,
+                     result.find_ns, result.read_ns);
+    }
+
+    SPFR::ReadOptions compact_lazy = compact;
+    compact_lazy.lazy_values = true;
+
+    std::vector<StorageResult> storages;
+
+    for (const auto &mode : {std::make_pair("mapped", mapped), std::make_pair("lazy", lazy),
+                             std::make_pair("compact", compact), std::make_pair("compact lazy", compact_lazy)})
+    {
+        storages.push_back(run_storage(mode.first, max_keys, mode.second));
+    }
+
+    std::fprintf(table, "\nMemory per parameter after the load of %d keys\n%12s %12s %12s\n", max_keys, "mode",
+                 "heap [B]", "text [B]");
+
+    for (const StorageResult &result : storages)
+    {
+        std::fprintf(table, "%12s %12.1f %12.1f\n", result.mode, result.heap_bytes, result.text_bytes);
+    }
+
+    std::vector<StructResult> structs = run_struct(mapped);
+
+    std::fprintf(table, "\nLoad of test.config into a struct\n%12s %12s %10s\n", "reader", "load [us]", "allocs");
+
+    for (const StructResult &result : structs)
+    {
+        std::fprintf(table, "%12s %12.2f %10lld\n", result.reader, result.load_us, result.allocations);
+    }
+
+    if (!json_file.empty())
+    {
+        std::string json = to_json(clock_ns, loads, arrays, threads, parallel_loads, reloads, schemas, storages,
+                                   structs);
+
+        if (json_file == "-") std::fwrite(json.data(), 1, json.size(), stdout);
+        else std::ofstream(json_file) << json;
+    }
+
+    return 0;
+}
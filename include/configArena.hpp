@@ -0,0 +1,90 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configArena.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Memory of one loaded configuration, which is taken in a few large blocks and freed in one step.
+ *
+ * The texts, tokens, hashes, index and converted values of a load live in the arena. A reload therefore doesn't
+ * leave many small holes in the heap, the blocks of the replaced version are given back as a whole.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_ARENA_HPP_AP_17102026
+#define HEADER_CONFIG_ARENA_HPP_AP_17102026
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+
+namespace SPFR
+{
+/** @class ConfigArena
+ *  @brief Monotonic memory resource which can be used by several threads at once.
+ *
+ *  Freed memory is not reused, it is only given back when the arena is destroyed. The blocks come from the upstream
+ *  resource and grow with every block, so even a big configuration only needs a few of them.
+ */
+class ConfigArena : public std::pmr::memory_resource
+{
+public:
+        explicit ConfigArena(std::pmr::memory_resource *upstream = std::pmr::get_default_resource());
+        ConfigArena(const ConfigArena &) = delete;
+        ConfigArena &operator=(const ConfigArena &) = delete;
+
+        /** Number of bytes which were handed out, including the ones of containers which grew in the meantime. */
+        std::size_t size() const;
+
+private:
+        static constexpr std::size_t first_block_size = 16384;
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *memory, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+        mutable std::mutex mutex;                   // Blocks of the BumpArena are taken by the reading threads.
+        std::pmr::monotonic_buffer_resource blocks;
+        std::size_t allocated = 0;
+};
+
+/** @class BumpArena
+ *  @brief Monotonic memory resource without a lock, for the memory which the reading threads allocate.
+ *
+ *  A thread reserves its bytes in the current block with a compare and swap of the used size. Only a new block, whose
+ *  size doubles up to 1 MB, and an allocation which doesn't fit in a block come from the upstream resource, e.g. a
+ *  ConfigArena, which takes its lock. The memory is given back with the upstream resource.
+ */
+class BumpArena : public std::pmr::memory_resource
+{
+public:
+        explicit BumpArena(std::pmr::memory_resource *upstream) : upstream(upstream) {}
+        BumpArena(const BumpArena &) = delete;
+        BumpArena &operator=(const BumpArena &) = delete;
+
+private:
+        struct Block
+        {
+            std::size_t size;                       // Bytes behind the header.
+            std::atomic<std::size_t> used;
+        };
+
+        static constexpr std::size_t first_block_size = 4096;
+        static constexpr std::size_t max_block_size = 1048576;
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *memory, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+        std::pmr::memory_resource *upstream;
+        std::atomic<Block *> current{nullptr};
+};
+}
+
+#endif // HEADER_CONFIG_ARENA_HPP_AP_17102026
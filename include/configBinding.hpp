@@ -0,0 +1,95 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configBinding.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Registry of parameters which are read together.
+ *
+ * A program registers the name and the variable of every parameter once and reads all of them with one call of
+ * ReadConfig::resolve(), which returns one summary instead of printing one message per parameter.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_BINDING_HPP_AP_17102026
+#define HEADER_CONFIG_BINDING_HPP_AP_17102026
+
+#include <cstddef>
+#include <string>
+#include <variant>
+#include <vector>
+
+
+namespace SPFR
+{
+/** @struct BindError
+ *  @brief A parameter which was found, but couldn't be converted to the type of its variable.
+ */
+struct BindError
+{
+        std::string parameter;
+        std::string message;
+};
+
+/** @struct BindSummary
+ *  @brief Result of ReadConfig::resolve() and of the parse of a generated struct. Variables of missing or invalid
+ *         parameters keep their initial values.
+ */
+struct BindSummary
+{
+        std::size_t found = 0;
+        std::vector<std::string> missing;
+        std::vector<BindError> errors;
+
+        bool ok() const { return this->missing.empty() && this->errors.empty(); }
+};
+
+/** @class ConfigBinding
+ *  @brief Names and variables of the parameters, which are filled by ReadConfig::resolve().
+ *
+ *  The variables are kept as pointers, so they have to outlive every resolve() call with this binding.
+ */
+class ConfigBinding
+{
+public:
+        /** Array variable with the number of fields the parameter has to have. */
+        template <typename T>
+        struct Array
+        {
+            T *values;
+            int size;
+        };
+
+        using Target = std::variant<std::string *, char *, int *, float *, bool *, Array<int>, Array<float>,
+                                    Array<char>, Array<std::string>>;
+
+        struct Binding
+        {
+            std::string name;
+            Target target;
+        };
+
+        void bind(std::string str_value_name, std::string &str_value);
+        void bind(std::string char_value_name, char &char_value);
+        void bind(std::string int_value_name, int &int_value);
+        void bind(std::string float_value_name, float &float_value);
+        void bind(std::string bool_value_name, bool &bool_value);
+        void bind(std::string int_arr_value_name, int *int_arr_value, int int_arr_size);
+        void bind(std::string float_arr_value_name, float *float_arr_value, int float_arr_size);
+        void bind(std::string char_arr_value_name, char *char_arr_value, int char_arr_size);
+        void bind(std::string str_arr_value_name, std::string *str_array_value, int str_arr_size);
+
+        const std::vector<Binding> &bindings() const { return this->entries; }
+        std::size_t size() const { return this->entries.size(); }
+        void clear() { this->entries.clear(); }
+
+private:
+        std::vector<Binding> entries;
+};
+}
+
+#endif // HEADER_CONFIG_BINDING_HPP_AP_17102026
@@ -0,0 +1,69 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configBlocks.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Blocks of lines with checksums, so a reload only tokenizes the changed parts of a file.
+ *
+ * The bounds of the blocks depend on the content of the lines and not on their position. An edit of one line only
+ * changes the block around it, all other blocks of the file keep their bounds and checksums.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_BLOCKS_HPP_AP_17102026
+#define HEADER_CONFIG_BLOCKS_HPP_AP_17102026
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+
+namespace SPFR
+{
+struct ConfigLayer;
+
+/** @struct TextBlock
+ *  @brief Whole lines of a file and the position of their tokens in the tokens of the whole file.
+ */
+struct TextBlock
+{
+        std::size_t begin;                      // Offset of the first byte in the text.
+        std::size_t size;
+        std::uint64_t checksum;                 // Of the text as it was read, before the tokenizer compacted it.
+        std::size_t first_token;
+};
+
+/**
+ *  @brief Cuts a text behind line ends into blocks and computes their checksums.
+ *
+ *  A block ends behind a line whose hash has its lowest bits cleared, which happens for one of 64 lines, and after
+ *  1024 lines at the latest.
+ *
+ *  @param text     Text of the configuration file, as it was read.
+ *  @param size     Number of bytes in the text.
+ *  @param blocks   Receives the blocks in the order of the text.
+ */
+void split_blocks(const char *text, std::size_t size, std::pmr::vector<TextBlock> &blocks);
+
+/**
+ *  @brief Tokenizes the text of a layer block by block and hashes its names.
+ *
+ *  The blocks of the layer have to be split already. A block which the previous version of the file has as well is
+ *  not tokenized again, it takes over the tokens and name hashes of the previous version. The changed blocks are
+ *  shared among the threads, but not in parts below 1 MB.
+ *
+ *  @param layer        Layer with the text and the blocks of the file. Receives the tokens, spills and hashes.
+ *  @param previous     Layer of the previous version of the file, or nullptr to tokenize every block.
+ *  @param thread_count Maximum number of threads, including the calling one.
+ *  @return             Number of bytes which were tokenized.
+ */
+std::size_t tokenize_blocks(ConfigLayer &layer, const ConfigLayer *previous, unsigned thread_count);
+}
+
+#endif // HEADER_CONFIG_BLOCKS_HPP_AP_17102026
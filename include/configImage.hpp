@@ -0,0 +1,122 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configImage.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Compiled binary image of a configuration file.
+ *
+ * The image holds the hash table of the parameter names and all values which could already be converted, so a
+ * program which maps it neither tokenizes nor parses numbers. All positions in the image are offsets from its start.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_IMAGE_HPP_AP_17102026
+#define HEADER_CONFIG_IMAGE_HPP_AP_17102026
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "configKey.hpp"
+#include "mappedFile.hpp"
+#include "valueConversion.hpp"
+
+
+namespace SPFR
+{
+/** @class ConfigImage
+ *  @brief Writes and maps the compiled image of a configuration file.
+ *
+ *  Layout of the image, every section starts 8 byte aligned:
+ *
+ *      Header          magic "SPFRIMG", byte order mark, format version, entry and slot count, section offsets,
+ *                      generation of a published image
+ *      Entries         one fixed size record per parameter: hash, name, text and the converted values
+ *      Slots           hash table of entry numbers with linear probing, at most half full
+ *      Arrays          4 byte fields of the converted int and float arrays
+ *      Strings         parameter names and the tokenized value texts
+ *
+ *  Opening only checks the header, so it takes the same time for every size. The ranges of an entry are checked
+ *  when the entry is read.
+ *
+ *  An image can also be published in POSIX shared memory, where all processes of the host map the same pages. The
+ *  image of a name is replaced by a rename, so a process keeps its mapping of the old image until it opens the new
+ *  one, and every published image has a generation one above the replaced one.
+ */
+class ConfigImage
+{
+public:
+        static constexpr std::uint32_t npos = 0xFFFFFFFFu;
+        static constexpr std::uint32_t format_version = 2;
+
+        /** Directory in which Linux keeps the objects of shm_open(). */
+        static constexpr const char *shared_memory_directory = "/dev/shm";
+
+        /** Reads a configuration file and its includes with the rules of the reader and writes its image. Fails if
+         *  a file has a name without a value. */
+        static bool compile(const std::string &config_file_name, const std::string &image_file_name,
+                            std::string &error);
+
+        /**
+         *  Compiles a configuration file into the shared memory object of the name, e.g. "/spfr_motor", which can be
+         *  opened with shm_open() as well. Calls for the same name must not overlap.
+         */
+        static bool publish(const std::string &config_file_name, const std::string &shared_name, std::string &error);
+
+        /** Path of the shared memory object of the name, which is opened like an image file. Empty for a bad name. */
+        static std::string shared_path(const std::string &shared_name);
+
+        bool open(const std::string &image_file_name, std::string &error);
+        void close();
+        bool is_open() const { return this->header != nullptr; }
+        std::uint32_t size() const;
+        std::uint64_t generation() const;
+
+        /** Number of the entry with this name, or npos. */
+        std::uint32_t find(const ConfigKey &key) const;
+        std::string_view name(std::uint32_t entry) const;
+        std::string_view text(std::uint32_t entry) const;
+
+        /** Points to the value converted by the compiler. False if the text isn't a valid value of this type. */
+        bool scalar(std::uint32_t entry, const int *&value) const;
+        bool scalar(std::uint32_t entry, const float *&value) const;
+        bool scalar(std::uint32_t entry, const bool *&value) const;
+        bool scalar(std::uint32_t entry, const char *&value) const;
+
+        /** Copies the converted number arrays and converts all other types from the text. */
+        bool convert(std::uint32_t entry, std::pmr::vector<int> &values) const;
+        bool convert(std::uint32_t entry, std::pmr::vector<float> &values) const;
+
+        template <typename T>
+        bool convert(std::uint32_t entry, T &value) const
+        {
+            return parse_value(this->text(entry), value);
+        }
+
+private:
+        struct Header;
+        struct Entry;
+
+        static bool compile(const std::string &config_file_name, const std::string &image_file_name,
+                            std::uint64_t generation, std::string &error);
+
+        const Entry *entry_at(std::uint32_t entry, std::uint8_t flag) const;
+        std::string_view string_at(std::uint32_t offset, std::uint32_t size) const;
+
+        MappedFile file;
+        const Header *header = nullptr;
+        const Entry *entries = nullptr;
+        const std::uint32_t *slots = nullptr;
+        const std::uint32_t *arrays = nullptr;
+        const char *strings = nullptr;
+};
+}
+
+#endif // HEADER_CONFIG_IMAGE_HPP_AP_17102026
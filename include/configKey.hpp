@@ -0,0 +1,62 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configKey.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Parameter name together with its hash, which can be computed at compile time.
+ *
+ * A key which is declared constexpr, or written as "name"_key, costs neither a string nor a hash at the read.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_KEY_HPP_AP_17102026
+#define HEADER_CONFIG_KEY_HPP_AP_17102026
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "keyIndex.hpp"
+
+
+namespace SPFR
+{
+/** @class ConfigKey
+ *  @brief Name of a parameter and its hash for the key index.
+ *
+ *  Only a view of the name is kept, so the name has to outlive the key. For string literals this is always true:
+ *
+ *      static constexpr SPFR::ConfigKey number_int("number_int");
+ *      read_config.get_parameter(number_int, value);
+ */
+class ConfigKey
+{
+public:
+        explicit constexpr ConfigKey(std::string_view name) noexcept : key_name(name), key_hash(KeyIndex::hash(name))
+        {
+        }
+
+        constexpr std::string_view name() const noexcept { return this->key_name; }
+        constexpr std::uint64_t hash() const noexcept { return this->key_hash; }
+
+private:
+        std::string_view key_name;
+        std::uint64_t key_hash;
+};
+
+namespace literals
+{
+/** "number_int"_key creates a ConfigKey. Assign it to a constexpr variable to force the hash at compile time. */
+constexpr ConfigKey operator""_key(const char *name, std::size_t size) noexcept
+{
+    return ConfigKey(std::string_view(name, size));
+}
+}
+}
+
+#endif // HEADER_CONFIG_KEY_HPP_AP_17102026
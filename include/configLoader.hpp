@@ -0,0 +1,85 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configLoader.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Loads configurations in the background on a small pool of threads.
+ *
+ * A program with many configuration files doesn't have to read them one after another at its start. The loads are
+ * started at once and every one returns a future, so the program only waits for a file when it needs it.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_LOADER_HPP_AP_17102026
+#define HEADER_CONFIG_LOADER_HPP_AP_17102026
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "readConfig.hpp"
+
+
+namespace SPFR
+{
+/** @class ConfigLoader
+ *  @brief Thread pool which constructs ReadConfig objects and hands them out as futures.
+ *
+ *  Every load is one job, the jobs are run in the order they were started. The destructor still runs the waiting
+ *  jobs, so every future gets its reader. A load which fails, e.g. because the file is missing, gives a reader with
+ *  the initial values, the same as the constructor of ReadConfig.
+ */
+class ConfigLoader
+{
+public:
+        using Pending = std::shared_future<std::shared_ptr<ReadConfig>>;
+
+        static constexpr const char *config_extension = ".config";
+
+        /** Starts the threads of the pool, 0 for one per core. */
+        explicit ConfigLoader(unsigned thread_count = 0);
+        ~ConfigLoader();
+        ConfigLoader(const ConfigLoader &) = delete;
+        ConfigLoader &operator=(const ConfigLoader &) = delete;
+
+        /** Starts the load of one configuration file. */
+        Pending load(std::string config_file_name, ReadOptions options = ReadOptions());
+
+        /** Starts the load of one configuration of several files, later files override earlier ones. */
+        Pending load(std::vector<std::string> config_file_names, ReadOptions options = ReadOptions());
+
+        /**
+         *  Starts one load for every *.config file of the directory, each file is its own configuration. The
+         *  returned map has the names of the files without the directory as keys.
+         */
+        std::map<std::string, Pending> load_directory(const std::string &directory, std::string &error,
+                                                      ReadOptions options = ReadOptions());
+
+        unsigned thread_count() const { return static_cast<unsigned>(this->threads.size()); }
+
+private:
+        using Job = std::packaged_task<std::shared_ptr<ReadConfig>()>;
+
+        Pending start(Job job);
+        void run();
+
+        std::mutex queue_mutex;
+        std::condition_variable queue_changed;
+        std::deque<Job> queue;
+        bool stopping = false;
+        std::vector<std::thread> threads;
+};
+}
+
+#endif // HEADER_CONFIG_LOADER_HPP_AP_17102026
@@ -0,0 +1,97 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configLog.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Diagnostics of the configuration reader.
+ *
+ * The messages of the reader can be printed, kept in a buffer, handed to a callback of the user or switched off.
+ * The buffer is a ring of a fixed capacity, so a long running program doesn't grow with every lookup.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_LOG_HPP_AP_17102026
+#define HEADER_CONFIG_LOG_HPP_AP_17102026
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace SPFR
+{
+/** @brief Severity of a diagnostic message. */
+enum class Severity
+{
+        Info,                   // A file was read or a parameter was found.
+        Warning,                // A parameter is missing, the initial value of the caller is kept.
+        Error                   // The file or a value is invalid.
+};
+
+/** @brief Where the diagnostic messages go. */
+enum class LogMode
+{
+        Stdout,                 // Print every message on the standard output, as the reader always did.
+        Silent,                 // Drop every message before it is formatted.
+        Buffered,               // Keep the latest messages, they can be fetched with ReadConfig::get_log().
+        Callback                // Hand every message to the callback of the user.
+};
+
+/** @brief Callback for the diagnostic messages. The parameter name is empty for messages about the whole file.
+ *
+ *  Parameters can be read from several threads, so the callback may be called from several threads at once.
+ */
+using LogCallback = std::function<void(Severity severity, std::string_view parameter, std::string_view message)>;
+
+/** @struct LogRecord
+ *  @brief One message kept by the buffered log mode.
+ */
+struct LogRecord
+{
+        Severity severity;
+        std::string parameter;
+        std::string message;
+};
+
+/** @class ConfigLog
+ *  @brief Sends the diagnostic messages to the chosen destination.
+ */
+class ConfigLog
+{
+public:
+        void configure(LogMode mode, Severity level, LogCallback callback, std::size_t capacity);
+
+        /** True if a message of this severity is written anywhere. Check it before formatting a message. */
+        bool enabled(Severity severity) const { return this->mode != LogMode::Silent && severity >= this->level; }
+
+        void write(Severity severity, std::string_view parameter, std::string_view message) const;
+
+        /** The kept messages, the oldest first. */
+        std::vector<LogRecord> records() const;
+
+        /** Number of the messages which were overwritten by newer ones, since the last clear(). */
+        std::uint64_t dropped() const;
+        void clear();
+
+private:
+        LogMode mode = LogMode::Stdout;
+        Severity level = Severity::Info;
+        LogCallback callback;
+        std::size_t capacity = 0;
+        mutable std::mutex write_mutex;
+        mutable std::vector<LogRecord> buffer;  // Filled by const reads, guarded by the mutex.
+        mutable std::size_t next = 0;           // Record which is overwritten next, once the buffer is full.
+        mutable std::uint64_t dropped_count = 0;
+};
+}
+
+#endif // HEADER_CONFIG_LOG_HPP_AP_17102026
@@ -0,0 +1,127 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configSchema.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Declared set of the parameters of a configuration and their types.
+ *
+ * The names of the schema get a minimal perfect hash, so a lookup of a declared parameter takes one hash and one
+ * compare and never probes. SPFR_bench doesn't show it faster than the key index. Every load checks the
+ * configuration against the schema.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_SCHEMA_HPP_AP_17102026
+#define HEADER_CONFIG_SCHEMA_HPP_AP_17102026
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "configKey.hpp"
+#include "configStats.hpp"
+
+
+namespace SPFR
+{
+/** @class ConfigSchema
+ *  @brief Parameters which a configuration is expected to have, with a perfect hash over their names.
+ *
+ *  The hash is built from the 64 bit hashes of the names, which a ConfigKey already carries. The bucket of a name
+ *  holds either the slot of its only name or a seed which spreads all names of the bucket over free slots. So every
+ *  name has its own slot and a find only compares the name in that slot. The slots have the same size, which is big
+ *  enough for the usual names, so the hash and the name are read from the same cache line. A schema is filled once
+ *  and then only read, so one schema can be shared by all readers of the same kind of configuration:
+ *
+ *      auto schema = std::make_shared<SPFR::ConfigSchema>();
+ *      schema->read("PATH_TO_THE_SCHEMA", error);
+ *      options.schema = schema;
+ */
+class ConfigSchema
+{
+public:
+        static constexpr std::uint32_t npos = 0xFFFFFFFFu;
+
+        struct Field
+        {
+            std::string name;
+            ParameterType type;
+        };
+
+        /** Replaces the fields and builds their hash. @return False if a name is declared twice. */
+        bool assign(std::vector<Field> fields, std::string &error);
+
+        /** Reads the fields from a file of "name: type" lines, e.g. "number_int: int" or "list: string_array". */
+        bool read(const std::string &file_name, std::string &error);
+
+        /** Number of the field, which is its slot of the hash, or npos if the name isn't in the schema. */
+        std::uint32_t find(std::string_view name, std::uint64_t name_hash) const
+        {
+            if (this->fields.empty()) return npos;
+
+            std::uint32_t bucket = this->buckets[reduce(mix(name_hash, 0), this->buckets.size())];
+
+            // A bucket with one name holds its slot with the top bit set, the other buckets hold the seed. Both slots
+            // are computed, so the choice needs no branch, which the processor couldn't predict.
+            std::uint32_t seeded = reduce(mix(name_hash, bucket), this->fields.size());
+            std::uint32_t number = (bucket & single_name) ? bucket & ~single_name : seeded;
+            const std::uint64_t *slot = this->slots.data() + number * this->slot_words;
+
+            // A slot is the hash, the size and the offset of the name, and the name itself if it fits.
+            std::size_t size = static_cast<std::uint32_t>(slot[1]);
+
+            if (slot[0] != name_hash || size != name.size()) return npos;
+
+            const char *text = size <= (this->slot_words - 2) * 8 ? reinterpret_cast<const char *>(slot + 2)
+                                                                    : this->names.data() + (slot[1] >> 32);
+
+            return std::memcmp(text, name.data(), size) == 0 ? number : npos;
+        }
+
+        std::uint32_t find(const ConfigKey &key) const { return this->find(key.name(), key.hash()); }
+        std::size_t size() const { return this->fields.size(); }
+        const Field &field(std::uint32_t number) const { return this->fields[number]; }
+
+        /** Number of a field by its position in the declaration. */
+        std::uint32_t declared(std::size_t position) const { return this->declaration[position]; }
+
+        /** Name of the type in a schema file, e.g. "int_array". */
+        static const char *type_name(ParameterType type);
+
+private:
+        static constexpr std::uint32_t single_name = 0x80000000u;
+
+        static constexpr std::size_t max_slot_words = 8;                // One cache line.
+
+        /** Spreads the hash of a name for one seed, the seed 0 chooses the bucket. */
+        static constexpr std::uint64_t mix(std::uint64_t name_hash, std::uint64_t seed)
+        {
+            std::uint64_t h = name_hash ^ (seed * 0x9E3779B97F4A7C15ull);
+
+            return (h ^ (h >> 32)) * 0xD6E8FEB86659FD93ull;
+        }
+
+        /** Maps a spread hash to 0 ... count - 1 by its upper half, which is cheaper than a division. */
+        static constexpr std::uint32_t reduce(std::uint64_t h, std::size_t count)
+        {
+            return static_cast<std::uint32_t>(((h >> 32) * count) >> 32);
+        }
+
+        std::vector<Field> fields;                      // In the order of their slots.
+        std::vector<std::uint32_t> declaration;         // Numbers of the fields in the order of the declaration.
+        std::vector<std::uint32_t> buckets;             // One for every two names.
+        std::vector<std::uint64_t> slots;               // One per field, so the hash is minimal.
+        std::size_t slot_words = 2;
+        std::string names;                              // Names which don't fit into their slot.
+};
+}
+
+#endif // HEADER_CONFIG_SCHEMA_HPP_AP_17102026
@@ -0,0 +1,168 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configSnapshot.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   One loaded version of a configuration file and the publication of new versions.
+ *
+ * A reload builds a complete new snapshot next to the current one and swaps a single pointer. Readers never wait for
+ * a reload, and a snapshot is only freed after the last reader which could still see it has left.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_SNAPSHOT_HPP_AP_17102026
+#define HEADER_CONFIG_SNAPSHOT_HPP_AP_17102026
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <experimental/filesystem>
+
+#include "compactStore.hpp"
+#include "configArena.hpp"
+#include "configBlocks.hpp"
+#include "configImage.hpp"
+#include "configSchema.hpp"
+#include "keyIndex.hpp"
+#include "mappedFile.hpp"
+#include "prefixIndex.hpp"
+#include "valueCache.hpp"
+
+
+namespace SPFR
+{
+/** @struct ConfigLayer
+ *  @brief One parsed file of a configuration, which can consist of several files.
+ *
+ *  A layer isn't changed after its file was parsed. Snapshots of later reloads share it as long as the file keeps its
+ *  size and modification time. With the incremental reload, the next version of the file takes over the tokens of
+ *  its unchanged blocks. The text, tokens, hashes and blocks are kept in the arena of the layer.
+ */
+struct ConfigLayer
+{
+        explicit ConfigLayer(std::shared_ptr<ConfigArena> layer_arena)
+            : arena(std::move(layer_arena)), buffer(arena.get()), spills(arena.get()), raw_config(arena.get()),
+              hashes(arena.get()), blocks(arena.get())
+        {
+
+        }
+
+        std::shared_ptr<ConfigArena> arena;             // Declared first, so it is freed last.
+        std::string file_name;
+        std::experimental::filesystem::file_time_type write_time;
+        std::experimental::filesystem::file_time_type read_time;
+        std::uintmax_t file_size = 0;
+        std::pmr::string buffer;                        // Text of the file in the buffered load mode.
+        MappedFile mapped_file;                         // Text of the file in the memory mapped load mode.
+        std::pmr::vector<std::pmr::deque<std::pmr::string>> spills;     // Tokens copied out of the mapped text.
+        std::pmr::vector<std::string_view> raw_config;  // Names and values, alternating.
+        std::pmr::vector<std::uint64_t> hashes;         // Hashes of the names, so a merge doesn't hash them again.
+        std::vector<std::string> includes;              // Files of the include directives, in their order.
+        std::pmr::vector<TextBlock> blocks;             // Only with the incremental reload.
+        bool lazy_values = false;                       // The values still have their spaces.
+        bool format_ok = true;                          // Every name has a value.
+};
+
+/** @struct ConfigSnapshot
+ *  @brief Everything that was read from one version of the configuration files.
+ *
+ *  A published snapshot is never changed again, except for the cache of the converted values and the prefix index,
+ *  which is built by the first query of a prefix. The names and values of all layers are merged into one sequence,
+ *  in which the layer with the highest priority comes first. The merged sequence, the indexes and the cache live in
+ *  the arena of the snapshot, which a snapshot of a single file shares with its layer. With the compact storage the
+ *  names and values are copied into the arena of the snapshot instead, so the layers can be freed.
+ */
+struct ConfigSnapshot
+{
+        explicit ConfigSnapshot(std::shared_ptr<ConfigArena> snapshot_arena)
+            : arena(std::move(snapshot_arena)), raw_config(arena.get()), compact(arena.get()), key_index(arena.get()),
+              schema_positions(arena.get()), typed_values(arena.get()), prefix_index(arena.get())
+        {
+
+        }
+
+        std::shared_ptr<ConfigArena> arena;             // Declared first, so it is freed last.
+        std::uint64_t version = 0;
+        bool data_size_ok = false;
+        std::vector<std::shared_ptr<const ConfigLayer>> layers;     // Texts of the files, from the lowest priority.
+        ConfigImage image;                              // Index and values in the compiled load mode.
+        std::pmr::vector<std::string_view> raw_config;  // Names and values of all layers, alternating.
+        bool lazy_values = false;                       // The values still have their spaces.
+        CompactStore compact;                           // Names and values with the compact storage, then the
+                                                        // raw_config, the key index and the layers are empty.
+        KeyIndex key_index;                             // With a schema only the names which aren't in it.
+        std::shared_ptr<const ConfigSchema> schema;
+        std::pmr::vector<std::uint32_t> schema_positions;       // Position of every field of the schema, or npos.
+        ValueCache typed_values;                        // Converted values, filled by the reads.
+        mutable std::once_flag prefix_once;
+        mutable PrefixIndex prefix_index;               // Built by the first prefix query.
+};
+
+/** @class SnapshotDomain
+ *  @brief Publishes snapshots with an atomic pointer and frees the replaced ones after a grace period.
+ *
+ *  A reader registers in the counter of the current epoch before it loads the pointer. A writer swaps the pointer,
+ *  starts the next epoch and waits until the counter of the previous epoch is empty. After that, no reader can still
+ *  hold the old snapshot. Readers only do atomic increments and never wait for a writer.
+ *
+ *  The counters are spread over several cache lines and every thread uses its own stripe, so readers on different
+ *  cores don't write to the same cache line. A writer waits for the counters of all stripes.
+ */
+class SnapshotDomain
+{
+public:
+        SnapshotDomain() = default;
+        ~SnapshotDomain();
+        SnapshotDomain(const SnapshotDomain &) = delete;
+        SnapshotDomain &operator=(const SnapshotDomain &) = delete;
+
+        /** Replaces the current snapshot and frees the old one once no reader uses it. Calls must not overlap. */
+        void publish(std::unique_ptr<ConfigSnapshot> snapshot);
+
+        /** @class Guard
+         *  @brief Keeps the snapshot which was current at its construction alive while it exists.
+         */
+        class Guard
+        {
+        public:
+                explicit Guard(const SnapshotDomain &domain);
+                ~Guard();
+                Guard(const Guard &) = delete;
+                Guard &operator=(const Guard &) = delete;
+
+                const ConfigSnapshot &operator*() const { return *this->snapshot; }
+                const ConfigSnapshot *operator->() const { return this->snapshot; }
+
+        private:
+                std::atomic<long> *readers;
+                unsigned epoch;
+                const ConfigSnapshot *snapshot;
+        };
+
+private:
+        static constexpr std::size_t stripe_count = 16;
+
+        struct alignas(64) Stripe
+        {
+            std::atomic<long> readers[2] = {{0}, {0}};
+        };
+
+        std::atomic<ConfigSnapshot *> current{nullptr};
+        mutable std::atomic<unsigned> epoch{0};
+        mutable Stripe stripes[stripe_count];
+};
+}
+
+#endif // HEADER_CONFIG_SNAPSHOT_HPP_AP_17102026
@@ -0,0 +1,145 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configStats.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Statistics about the loads and the lookups of a configuration.
+ *
+ * The statistics are only collected if they were switched on in the ReadOptions. A copy of them can be fetched at
+ * any time and written as text or as JSON.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_STATS_HPP_AP_17102026
+#define HEADER_CONFIG_STATS_HPP_AP_17102026
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "configKey.hpp"
+
+
+namespace SPFR
+{
+/** @brief Types a parameter can be read as. */
+enum class ParameterType
+{
+        String,
+        Char,
+        Int,
+        Float,
+        Bool,
+        IntArray,
+        FloatArray,
+        CharArray,
+        StringArray
+};
+
+constexpr std::size_t parameter_type_count = 9;
+
+/** @struct LoadStats
+ *  @brief Size and duration of the phases of one load.
+ *
+ *  Comments are removed and lines are split by one pass of the tokenizer, so both are in the tokenize phase. The
+ *  index phase hashes the names and fills the index, for several files it merges them as well.
+ */
+struct LoadStats
+{
+        std::uint64_t version = 0;
+        std::size_t files = 0;
+        std::uintmax_t bytes = 0;
+        std::size_t parameters = 0;
+        double read_ms = 0;                     // Reading or mapping the files.
+        double tokenize_ms = 0;
+        double index_ms = 0;
+        double total_ms = 0;
+};
+
+/** @struct LookupStats
+ *  @brief Lookups of one parameter or of one type. A miss and a failure both keep the initial value of the caller.
+ */
+struct LookupStats
+{
+        std::string name;
+        std::uint64_t lookups = 0;
+        std::uint64_t misses = 0;               // The parameter isn't in the file.
+        std::uint64_t failures = 0;             // The value couldn't be converted to the type.
+};
+
+/** @struct ConfigStats
+ *  @brief Copy of the statistics of a ReadConfig object.
+ */
+struct ConfigStats
+{
+        bool enabled = false;
+        std::uint64_t loads = 0;
+        std::uint64_t failed_loads = 0;
+        LoadStats last_load;
+        std::vector<LookupStats> types;         // Every type, in the order of ParameterType.
+        std::vector<LookupStats> keys;          // Every tracked parameter which was looked up, the most read first.
+        std::uint64_t untracked_lookups = 0;    // Lookups of parameters which found no free counter.
+
+        std::string to_text() const;
+        std::string to_json() const;
+};
+
+/** @class StatsCollector
+ *  @brief Counts the loads and lookups, which can come from several threads at once.
+ *
+ *  The counters of the types and of the parameters are atomic, a lookup takes no lock. The parameters have a fixed
+ *  table of counters, in which a name takes a slot near its hash with its first lookup and keeps it. Names which find
+ *  no free slot, e.g. of a program which builds its names at runtime, are only counted by type.
+ */
+class StatsCollector
+{
+public:
+        StatsCollector() = default;
+        ~StatsCollector();
+        StatsCollector(const StatsCollector &) = delete;
+        StatsCollector &operator=(const StatsCollector &) = delete;
+
+        void count_lookup(const ConfigKey &key, ParameterType type, bool missing, bool invalid);
+        void count_load(const LoadStats &load, bool failed);
+        ConfigStats stats() const;
+        void clear();
+
+private:
+        static constexpr std::size_t max_tracked_keys = 1024;
+        static constexpr std::size_t max_probes = 16;
+
+        struct TypeCounters
+        {
+            std::atomic<std::uint64_t> lookups{0};
+            std::atomic<std::uint64_t> misses{0};
+            std::atomic<std::uint64_t> failures{0};
+        };
+
+        struct KeySlot
+        {
+            std::atomic<std::uint64_t> tag{0};                  // Hash of the name with the lowest bit set, 0 if free.
+            std::atomic<const std::string *> name{nullptr};     // Set once by the thread which took the slot.
+            TypeCounters counters;
+        };
+
+        KeySlot *find_slot(const ConfigKey &key);
+
+        TypeCounters types[parameter_type_count];
+        KeySlot keys[max_tracked_keys];
+        std::atomic<std::uint64_t> untracked_lookups{0};
+        mutable std::mutex load_mutex;
+        std::uint64_t loads = 0;
+        std::uint64_t failed_loads = 0;
+        LoadStats last_load;
+};
+}
+
+#endif // HEADER_CONFIG_STATS_HPP_AP_17102026
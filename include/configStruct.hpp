@@ -0,0 +1,86 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configStruct.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Support of the structs which SPFR_generate writes from a configuration template.
+ *
+ * A generated struct has one typed field per parameter and a parser which knows the names at compile time. It only
+ * needs the names and values of a file, which ConfigTokens provides, and read_field to convert one value.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_STRUCT_HPP_AP_17102026
+#define HEADER_CONFIG_STRUCT_HPP_AP_17102026
+
+#include <cstddef>
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "configBinding.hpp"
+#include "keyIndex.hpp"
+#include "mappedFile.hpp"
+#include "valueConversion.hpp"
+
+
+namespace SPFR
+{
+/** @class ConfigTokens
+ *  @brief Names and values of one configuration file, split by the same rules as in ReadConfig.
+ *
+ *  The tokens are views into the mapped file or into the given text, which therefore has to outlive them.
+ */
+class ConfigTokens
+{
+public:
+        /** Maps the file and splits it. @return False if the file can't be read. */
+        bool open(const std::string &file_name, std::string &error);
+
+        /** Splits a text in memory. */
+        void assign(std::string_view text);
+
+        /** Number of the pairs of a name and a value. A name without a value at the end is left out. */
+        std::size_t size() const { return this->tokens.size() / 2; }
+        std::string_view name(std::size_t pair) const { return this->tokens[2 * pair]; }
+        std::string_view value(std::size_t pair) const { return this->tokens[2 * pair + 1]; }
+
+private:
+        MappedFile file;
+        std::pmr::vector<std::string_view> tokens;
+        std::pmr::deque<std::pmr::string> spill;        // Tokens which had spaces inside.
+};
+
+/**
+ *  @brief Converts the value of one parameter into its field and counts it in the summary.
+ *
+ *  The overload of parse_value is chosen by the type of the field at compile time. An invalid value leaves the field
+ *  unchanged, also an array, of which parse_value would keep the valid fields.
+ */
+template <typename T>
+void read_field(std::string_view text, T &field, const char *name, BindSummary &summary)
+{
+    T value{};
+
+    if (parse_value(text, value))
+    {
+        field = std::move(value);
+        summary.found++;
+    }
+    else
+    {
+        summary.errors.push_back(BindError{name, "Cannot read the value " + std::string(text) +
+                                           " as the type of the field."});
+    }
+}
+}
+
+#endif // HEADER_CONFIG_STRUCT_HPP_AP_17102026
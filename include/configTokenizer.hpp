@@ -0,0 +1,142 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configTokenizer.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Splits the text of a configuration file into names and values.
+ *
+ * The tokenizer works in a single pass over the loaded text and returns views into it, so no token is copied. The
+ * views and the spilled tokens are kept in std::pmr containers, which take the memory resource of the caller.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONFIG_TOKENIZER_HPP_AP_17102026
+#define HEADER_CONFIG_TOKENIZER_HPP_AP_17102026
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace SPFR
+{
+// Name of the directive, which reads another file as a layer below the current file.
+constexpr std::string_view include_directive = "@include";
+
+// Includes nested deeper than this are treated as a loop.
+constexpr int max_include_depth = 16;
+
+/**
+ *  @brief Splits the text of a configuration file into tokens.
+ *
+ *  Comments start with a '#' and end with the line. The rest of every line is split at each ':' and every non-empty
+ *  part of the line becomes one token, from which all spaces are removed. Tokens with spaces inside are compacted in
+ *  place, so the buffer is modified and the returned views point into it.
+ *
+ *  @param buffer   Text of the configuration file.
+ *  @param size     Number of bytes in the buffer.
+ *  @param tokens   Receives the tokens in the order of the file.
+ */
+void tokenize_config(char *buffer, std::size_t size, std::pmr::vector<std::string_view> &tokens);
+
+/**
+ *  @brief Splits a read-only text of a configuration file into tokens.
+ *
+ *  Same rules as above, but the text is never written, e.g. for a memory mapped file. A token with spaces inside is
+ *  copied without them into the spill storage, except for arrays, which keep their spaces in the view.
+ *
+ *  @param text     Text of the configuration file.
+ *  @param size     Number of bytes in the text.
+ *  @param tokens   Receives the tokens in the order of the file.
+ *  @param spill    Storage for the tokens which had to be copied.
+ */
+void tokenize_config(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                     std::pmr::deque<std::pmr::string> &spill);
+
+/**
+ *  @brief Splits a big text on several threads into tokens.
+ *
+ *  The text is cut behind line ends into one chunk per thread, but not into chunks below 1 MB. The result is the
+ *  same as the one of the single-threaded tokenizer above.
+ *
+ *  @param thread_count Maximum number of threads, including the calling one.
+ */
+void tokenize_config(char *buffer, std::size_t size, std::pmr::vector<std::string_view> &tokens, unsigned thread_count);
+
+/**
+ *  @brief Splits a big read-only text on several threads into tokens.
+ *
+ *  Same as above for a text which can't be written. Every chunk has its own spill storage.
+ *
+ *  @param spills       Resized to one spill storage per thread.
+ */
+void tokenize_config(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                     std::pmr::vector<std::pmr::deque<std::pmr::string>> &spills, unsigned thread_count);
+
+/**
+ *  @brief Splits a read-only text into names and values without looking at the values.
+ *
+ *  A line of a name without spaces inside, one ':' and a value gives the name and the raw value up to the comment or
+ *  the line end, only the line end, the '#' and the ':' are searched for. The value is trimmed, but keeps the spaces
+ *  inside and has to be cleaned when it is read. Every other line is split with the full rules of tokenize_config, so
+ *  after removing the spaces the tokens are the same. Only in a broken file, where a line without a value shifts the
+ *  following values onto the places of names, such a name can keep its spaces.
+ *
+ *  @param text     Text of the configuration file.
+ *  @param size     Number of bytes in the text.
+ *  @param tokens   Receives the tokens in the order of the file.
+ *  @param spill    Storage for the tokens which had to be copied.
+ */
+void tokenize_config_lazy(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                          std::pmr::deque<std::pmr::string> &spill);
+
+/**
+ *  @brief Splits a big read-only text on several threads into names and raw values.
+ *
+ *  @param spills       Resized to one spill storage per thread.
+ */
+void tokenize_config_lazy(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                          std::pmr::vector<std::pmr::deque<std::pmr::string>> &spills, unsigned thread_count);
+
+/**
+ *  @brief Finds the include directives in the tokens of a configuration file.
+ *
+ *  An included file is found relative to the directory of the file which includes it, unless its path is absolute.
+ *
+ *  @param file_name    Name of the file the tokens come from.
+ *  @param tokens       Tokens of the file, also lazily split ones.
+ *  @param includes     Receives the included files in the order of their directives.
+ */
+void find_includes(const std::string &file_name, const std::pmr::vector<std::string_view> &tokens,
+                   std::vector<std::string> &includes);
+
+// Reads one file of the includes and returns the files it includes, or false if the file can't be read.
+using FileReader = std::function<bool(const std::string &file_name, std::vector<std::string> &includes)>;
+
+/**
+ *  @brief Reads a configuration file and the files it includes, with the included files before the file itself.
+ *
+ *  The text reader and the compiler share these rules, so both see the same files in the same order.
+ *
+ *  @param file_name    Name of the configuration file.
+ *  @param read_file    Reads one file and returns its includes from find_includes(), or false if the file can't be
+ *                      read. It is called again for a file which is included twice, which it can keep from before.
+ *  @param add_file     Called for every file after its includes, so from the lowest to the highest priority.
+ *  @param error        Receives the reason, if a file includes itself or the includes are nested deeper than
+ *                      max_include_depth. It stays empty if read_file failed, which reports its own errors.
+ *  @return             False if a file couldn't be read.
+ */
+bool read_includes(const std::string &file_name, const FileReader &read_file,
+                   const std::function<void(const std::string &file_name)> &add_file, std::string &error);
+}
+
+#endif // HEADER_CONFIG_TOKENIZER_HPP_AP_17102026
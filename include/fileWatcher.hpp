@@ -0,0 +1,69 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    fileWatcher.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Watches a file for changes with inotify.
+ *
+ * The watcher runs its own thread and calls a callback every time one of the files was written or replaced.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_FILE_WATCHER_HPP_AP_17102026
+#define HEADER_FILE_WATCHER_HPP_AP_17102026
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace SPFR
+{
+/** @class FileWatcher
+ *  @brief Calls a callback from a background thread after a file was changed.
+ *
+ *  The directories of the files are watched, so files which are replaced by a rename, as most editors and deployment
+ *  tools do it, are noticed too. The watched files can be replaced while the watcher runs, e.g. from the callback.
+ */
+class FileWatcher
+{
+public:
+        FileWatcher() = default;
+        ~FileWatcher();
+        FileWatcher(const FileWatcher &) = delete;
+        FileWatcher &operator=(const FileWatcher &) = delete;
+
+        bool start(const std::string &file_name, std::function<void()> changed, std::string &error);
+        bool start(const std::vector<std::string> &file_names, std::function<void()> changed, std::string &error);
+        bool watch(const std::vector<std::string> &file_names, std::string &error);
+        void stop();
+        bool running() const;
+
+private:
+        struct WatchedFile
+        {
+            int directory_watch;
+            std::string base_name;
+        };
+
+        /** Removes the watches of the directories of old_files which new_files doesn't need anymore. */
+        void remove_unused(const std::vector<WatchedFile> &old_files, const std::vector<WatchedFile> &new_files);
+        void run();
+
+        std::mutex files_mutex;
+        std::vector<WatchedFile> files;
+        std::function<void()> changed;
+        int inotify_descriptor = -1;
+        int stop_pipe[2] = {-1, -1};
+        std::thread thread;
+};
+}
+
+#endif // HEADER_FILE_WATCHER_HPP_AP_17102026
@@ -0,0 +1,82 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    keyIndex.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Hash index over the parameter names of a loaded configuration file.
+ *
+ * The index maps a parameter name to the position of its entry, so a lookup no longer has to walk through all
+ * parameters of the file.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_KEY_INDEX_HPP_AP_17102026
+#define HEADER_KEY_INDEX_HPP_AP_17102026
+
+#include <cstdint>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+
+namespace SPFR
+{
+/** @class KeyIndex
+ *  @brief Open addressing hash table from parameter names to entry positions.
+ *
+ *  The names are stored as views, therefore the memory they point to has to outlive the index. The first inserted
+ *  entry of a name wins, which is the same rule the linear search through the file had.
+ */
+class KeyIndex
+{
+public:
+        static constexpr std::uint32_t npos = 0xFFFFFFFFu;
+
+        /** 64 bit FNV-1a hash of a parameter name. */
+        static constexpr std::uint64_t hash(std::string_view key) noexcept
+        {
+            std::uint64_t h = 14695981039346656037ull;
+
+            for (std::size_t i = 0; i < key.size(); i++)
+            {
+                h ^= static_cast<unsigned char>(key[i]);
+                h *= 1099511628211ull;
+            }
+
+            return h;
+        }
+
+        explicit KeyIndex(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) : slots(resource) {}
+
+        void clear();
+        void reserve(std::size_t count);
+        bool insert(std::string_view key, std::uint32_t position);
+        bool insert(std::string_view key, std::uint64_t key_hash, std::uint32_t position);
+        std::uint32_t find(std::string_view key) const;
+        std::uint32_t find(std::string_view key, std::uint64_t key_hash) const;
+        std::size_t size() const { return this->count; }
+        std::size_t capacity() const { return this->slots.size(); }
+
+private:
+        struct Slot
+        {
+            std::uint64_t key_hash;
+            std::string_view key;
+            std::uint32_t position;
+        };
+
+        void grow();
+
+        std::pmr::vector<Slot> slots;
+        std::size_t mask = 0;
+        std::size_t count = 0;
+};
+}
+
+#endif // HEADER_KEY_INDEX_HPP_AP_17102026
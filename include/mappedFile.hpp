@@ -0,0 +1,55 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    mappedFile.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Read-only memory mapping of a file.
+ *
+ * Gives access to the content of a file without copying it into the heap.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_MAPPED_FILE_HPP_AP_17102026
+#define HEADER_MAPPED_FILE_HPP_AP_17102026
+
+#include <cstddef>
+#include <string>
+
+
+namespace SPFR
+{
+/** @class MappedFile
+ *  @brief Read-only memory mapping of a file, which is unmapped again by the destructor.
+ */
+class MappedFile
+{
+public:
+        /** How the mapping is read, the kernel reads ahead accordingly. */
+        enum class Access
+        {
+                Sequential,             // Once from the beginning to the end, like the tokenizer.
+                Random                  // Scattered single reads, like the lookups in a compiled image.
+        };
+
+        MappedFile() = default;
+        ~MappedFile();
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        bool open(const std::string &file_name, std::string &error, Access access = Access::Sequential);
+        void close();
+        const char *data() const { return this->mapping; }
+        std::size_t size() const { return this->length; }
+
+private:
+        const char *mapping = nullptr;
+        std::size_t length = 0;
+};
+}
+
+#endif // HEADER_MAPPED_FILE_HPP_AP_17102026
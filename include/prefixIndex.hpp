@@ -0,0 +1,78 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    prefixIndex.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Sorted index over the parameter names of a loaded configuration.
+ *
+ * Names with a common prefix, e.g. all parameters of the section "motor.", are neighbours in the sorted order. A
+ * query for a prefix is therefore two binary searches instead of a walk through all parameters.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_PREFIX_INDEX_HPP_AP_17102026
+#define HEADER_PREFIX_INDEX_HPP_AP_17102026
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+
+namespace SPFR
+{
+/** @class PrefixIndex
+ *  @brief Array of the parameter names in their byte order, with the entry number of every name.
+ *
+ *  The names are stored as views, therefore the memory they point to has to outlive the index. Of several entries
+ *  with the same name, only the one with the lowest number is kept, which is the same rule the key index has.
+ */
+class PrefixIndex
+{
+public:
+        struct Entry
+        {
+            std::uint64_t bytes;                // Eight bytes of the name, only used while sorting.
+            std::string_view name;
+            std::uint32_t entry;
+        };
+
+        /** Entries of one prefix, in the order of their names. */
+        struct Range
+        {
+            const Entry *first;
+            const Entry *last;
+
+            const Entry *begin() const { return this->first; }
+            const Entry *end() const { return this->last; }
+            std::size_t size() const { return static_cast<std::size_t>(this->last - this->first); }
+        };
+
+        explicit PrefixIndex(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : entries(resource)
+        {
+
+        }
+
+        void reserve(std::size_t count) { this->entries.reserve(count); }
+        void add(std::string_view name, std::uint32_t entry) { this->entries.push_back(Entry{0, name, entry}); }
+
+        /** Sorts the added names and removes the duplicates. Has to be called after the last add(). */
+        void sort();
+
+        /** All names which start with the prefix. An empty prefix gives all names. */
+        Range find(std::string_view prefix) const;
+        std::size_t size() const { return this->entries.size(); }
+
+private:
+        std::pmr::vector<Entry> entries;
+};
+}
+
+#endif // HEADER_PREFIX_INDEX_HPP_AP_17102026
@@ -17,13 +17,60 @@
 #ifndef HEADER_READER_HPP_AP_03112020
 #define HEADER_READER_HPP_AP_03112020
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <list>
 
+#include "configBinding.hpp"
+#include "configKey.hpp"
+#include "configLog.hpp"
+#include "configSchema.hpp"
+#include "configSnapshot.hpp"
+#include "configStats.hpp"
+#include "fileWatcher.hpp"
+
 
 namespace SPFR
 {
+/** @brief Ways to bring the configuration file into memory. */
+enum class LoadMode
+{
+        Buffered,               // Copy the whole file into the heap. Files are limited to 1 MB.
+        MemoryMapped,           // Map the file read-only and tokenize it in place. There is no size limit. With
+                                // hot_reload the file is read into the heap instead, because a file rewritten in
+                                // place would change the text of the published version, or end it with SIGBUS.
+        Compiled,               // Map an image of SPFR_compile, which is already indexed and converted.
+        Shared                  // Map an image of ConfigImage::publish() by its shared memory name.
+};
+
+/** @struct ReadOptions
+ *  @brief Options for reading the configuration file.
+ */
+struct ReadOptions
+{
+        LoadMode load_mode = LoadMode::Buffered;
+        LogMode log_mode = LogMode::Stdout;
+        Severity log_level = Severity::Info;    // Messages below this severity are dropped.
+        LogCallback log_callback;               // Receives the messages in the callback log mode.
+        std::size_t log_capacity = 1024;        // Messages kept in the buffered log mode, older ones are dropped.
+        bool hot_reload = false;                // Reload in the background every time a file changes.
+        unsigned parse_threads = 1;             // Threads which tokenize and index a text file, 0 for one per core.
+        bool incremental_reload = false;        // Keep the checksums of blocks of lines and only tokenize changed ones.
+        bool collect_stats = false;             // Count the loads and lookups for get_stats(). A lookup increments
+                                                // 2 to 4 atomic counters without a lock, the first of a name copies
+                                                // the name. At most 1024 names are counted one by one.
+        bool lazy_values = false;               // Only split off the names at the load, clean values when read.
+        bool compact_storage = false;           // Copy names and values into one pool with a small index.
+        std::shared_ptr<const ConfigSchema> schema;             // Expected parameters, checked at every load.
+        std::pmr::memory_resource *memory_resource = nullptr;  // Gives the blocks of the arenas, nullptr for the heap.
+};
+
 /** @class ReadConfig
  *  @brief Header file to read the configuration file.
  *
@@ -34,26 +81,107 @@ class ReadConfig
 {
 public:
 	ReadConfig(std::string config_file_name);
+        ReadConfig(std::string config_file_name, ReadOptions options);
+        ReadConfig(std::vector<std::string> config_file_names);
+        ReadConfig(std::vector<std::string> config_file_names, ReadOptions options);
 	virtual ~ReadConfig();				// Virtual Destructor.
-        void get_parameter(std::string str_value_name, std::string &str_value);
-        void get_parameter(std::string char_value_name, char &char_value);
-        void get_parameter(std::string int_value_name, int &int_value);
-        void get_parameter(std::string float_value_name, float &float_value);
-        void get_parameter(std::string bool_value_name, bool &bool_value);
-        void get_parameter(std::string int_arr_value_name, int *int_arr_value, int int_arr_size);
-        void get_parameter(std::string float_arr_value_name, float *float_arr_value, int float_arr_size);
-        void get_parameter(std::string char_arr_value_name, char *char_arr_value, int char_arr_size);
-        void get_parameter(std::string str_arr_value_name, std::string *str_array_value, int str_arr_size);
+        ReadConfig(const ReadConfig &) = delete;    // The watcher thread refers to this object.
+        ReadConfig &operator=(const ReadConfig &) = delete;
+        void get_parameter(std::string str_value_name, std::string &str_value) const;
+        void get_parameter(std::string char_value_name, char &char_value) const;
+        void get_parameter(std::string int_value_name, int &int_value) const;
+        void get_parameter(std::string float_value_name, float &float_value) const;
+        void get_parameter(std::string bool_value_name, bool &bool_value) const;
+        void get_parameter(std::string int_arr_value_name, int *int_arr_value, int int_arr_size) const;
+        void get_parameter(std::string float_arr_value_name, float *float_arr_value, int float_arr_size) const;
+        void get_parameter(std::string char_arr_value_name, char *char_arr_value, int char_arr_size) const;
+        void get_parameter(std::string str_arr_value_name, std::string *str_array_value, int str_arr_size) const;
+        void get_parameter(const ConfigKey &str_value_key, std::string &str_value) const;
+        void get_parameter(const ConfigKey &char_value_key, char &char_value) const;
+        void get_parameter(const ConfigKey &int_value_key, int &int_value) const;
+        void get_parameter(const ConfigKey &float_value_key, float &float_value) const;
+        void get_parameter(const ConfigKey &bool_value_key, bool &bool_value) const;
+        void get_parameter(const ConfigKey &int_arr_value_key, int *int_arr_value, int int_arr_size) const;
+        void get_parameter(const ConfigKey &float_arr_value_key, float *float_arr_value, int float_arr_size) const;
+        void get_parameter(const ConfigKey &char_arr_value_key, char *char_arr_value, int char_arr_size) const;
+        void get_parameter(const ConfigKey &str_arr_value_key, std::string *str_array_value, int str_arr_size) const;
+        void get_parameter(std::string int_arr_value_name, std::vector<int> &int_arr_values) const;
+        void get_parameter(std::string float_arr_value_name, std::vector<float> &float_arr_values) const;
+        void get_parameter(std::string char_arr_value_name, std::vector<char> &char_arr_values) const;
+        void get_parameter(std::string str_arr_value_name, std::vector<std::string> &str_arr_values) const;
+        void get_parameter(const ConfigKey &int_arr_value_key, std::vector<int> &int_arr_values) const;
+        void get_parameter(const ConfigKey &float_arr_value_key, std::vector<float> &float_arr_values) const;
+        void get_parameter(const ConfigKey &char_arr_value_key, std::vector<char> &char_arr_values) const;
+        void get_parameter(const ConfigKey &str_arr_value_key, std::vector<std::string> &str_arr_values) const;
+        int get_array(std::string int_arr_value_name, int *int_arr_value, int capacity) const;
+        int get_array(std::string float_arr_value_name, float *float_arr_value, int capacity) const;
+        int get_array(std::string char_arr_value_name, char *char_arr_value, int capacity) const;
+        int get_array(std::string str_arr_value_name, std::string *str_array_value, int capacity) const;
+        int get_array(const ConfigKey &int_arr_value_key, int *int_arr_value, int capacity) const;
+        int get_array(const ConfigKey &float_arr_value_key, float *float_arr_value, int capacity) const;
+        int get_array(const ConfigKey &char_arr_value_key, char *char_arr_value, int capacity) const;
+        int get_array(const ConfigKey &str_arr_value_key, std::string *str_array_value, int capacity) const;
+        BindSummary resolve(const ConfigBinding &binding) const;
+        BindSummary resolve(const ConfigBinding &binding, std::string prefix) const;
+        std::vector<std::string> get_keys(std::string prefix) const;
+        bool reload();
+        std::uint64_t get_version() const;
+        std::uint64_t get_generation() const;                   // Of a published image, otherwise 0.
+        std::vector<LogRecord> get_log() const;
+        std::uint64_t get_log_dropped() const;                  // Messages the buffered log mode overwrote.
+        void clear_log();
+        ConfigStats get_stats() const;
+        void clear_stats();
 
 private:
+        enum class Lookup { Missing, Found, Invalid };
+
+        using LayerCache = std::map<std::string, std::shared_ptr<ConfigLayer>>;
+
 	void Init();
-        void check_data_size();
-        bool data_size_tested;
-        bool data_size_ok;
-	std::string remove_comments(std::string &buffer);
-	std::string _config_file_name;
-        std::vector<std::string> split(const std::string& s, std::string delimiter, std::string delete_chars);
-        std::vector<std::string> raw_config;
+        std::shared_ptr<ConfigArena> make_arena() const;
+        std::unique_ptr<ConfigSnapshot> load(std::vector<std::string> &file_names);
+        std::unique_ptr<ConfigSnapshot> read_files(std::vector<std::string> &file_names);
+        bool add_layers(const std::string &file_name, unsigned thread_count, LayerCache &loaded,
+                        std::vector<std::shared_ptr<ConfigLayer>> &layers, std::vector<std::string> &file_names);
+        std::shared_ptr<ConfigLayer> read_layer(const std::string &file_name, unsigned thread_count,
+                                                LayerCache &loaded);
+        static void merge_layers(ConfigSnapshot &snapshot, const std::vector<std::shared_ptr<ConfigLayer>> &layers);
+        static bool compact_layers(ConfigSnapshot &snapshot, const std::vector<std::shared_ptr<ConfigLayer>> &layers);
+        static void hash_names(const std::pmr::vector<std::string_view> &raw_config,
+                               std::pmr::vector<std::uint64_t> &hashes, unsigned thread_count);
+        static void build_index(ConfigSnapshot &snapshot, unsigned thread_count);
+        static void prepare_index(ConfigSnapshot &snapshot, std::size_t name_count);
+        static void index_name(ConfigSnapshot &snapshot, std::string_view name, std::uint64_t name_hash,
+                               std::uint32_t position);
+        static std::uint32_t find_entry(const ConfigSnapshot &snapshot, const ConfigKey &key);
+        void check_schema(const ConfigSnapshot &snapshot) const;
+        static bool find_value(const ConfigSnapshot &snapshot, const ConfigKey &key, std::string_view &value);
+        static std::string_view value_text(const ConfigSnapshot &snapshot, std::uint32_t entry);
+        static PrefixIndex::Range find_prefix(const ConfigSnapshot &snapshot, std::string_view prefix);
+        template <typename T> Lookup lookup(const ConfigSnapshot &snapshot, const ConfigKey &key,
+                                            const T *&value) const;
+        template <typename T> Lookup find_converted(const ConfigSnapshot &snapshot, const ConfigKey &key,
+                                                    const T *&value) const;
+        template <typename T> static std::size_t invalid_field(const ConfigSnapshot &snapshot, const ConfigKey &key);
+        template <typename T> void read_vector(const ConfigKey &key, std::vector<T> &values) const;
+        template <typename T> int read_array(const ConfigKey &key, T *values, int capacity) const;
+        template <typename T> void bind_value(const ConfigSnapshot &snapshot, const ConfigKey &key, T *destination,
+                                              BindSummary &summary) const;
+        template <typename T> void bind_value(const ConfigSnapshot &snapshot, const ConfigKey &key,
+                                              ConfigBinding::Array<T> destination, BindSummary &summary) const;
+        template <typename... Args> void report(Severity severity, std::string_view value_name,
+                                                const Args &... args) const;
+        std::vector<std::string> _config_file_names;    // Later files override earlier ones.
+        ReadOptions _options;
+        ConfigLog log;
+        SnapshotDomain snapshots;
+        std::mutex reload_mutex;
+        std::uint64_t next_version;
+        LayerCache layer_cache;                         // Parsed files of the last load, guarded by reload_mutex.
+        LoadStats load_stats;                           // Phases of the running load, guarded by reload_mutex.
+        std::unique_ptr<StatsCollector> stats;          // Only with the statistics switched on.
+        FileWatcher watcher;
 };
 }
 
@@ -0,0 +1,104 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    valueCache.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Cache of the converted values of a snapshot, which can be filled by several threads at once.
+ *
+ * Every entry has a short list of its conversions, one per requested type. Conversions are only ever added, so a
+ * pointer to a converted value stays valid as long as the cache exists. The heads of the lists are allocated for 256
+ * entries at once when the first of them is converted, so a parameter which is never read costs no head. The lists
+ * and the converted values take their memory without a lock from a BumpArena on top of the arena of the snapshot and
+ * are freed with it.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_VALUE_CACHE_HPP_AP_17102026
+#define HEADER_VALUE_CACHE_HPP_AP_17102026
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <variant>
+
+#include "configArena.hpp"
+#include "valueConversion.hpp"
+
+
+namespace SPFR
+{
+/** @class ValueCache
+ *  @brief Lock-free cache of converted values, one list of conversions per entry.
+ */
+class ValueCache
+{
+public:
+        /** The resource has to be a monotonic one like ConfigArena, the values are never destroyed one by one. */
+        explicit ValueCache(std::pmr::memory_resource *resource) : resource(resource), values(resource) {}
+        ValueCache(const ValueCache &) = delete;
+        ValueCache &operator=(const ValueCache &) = delete;
+
+        void resize(std::size_t count);
+
+        /** Returns an empty value of type T, whose strings and arrays use the memory of the cache. */
+        template <typename T>
+        T make_value() const
+        {
+            if constexpr (std::uses_allocator_v<T, std::pmr::polymorphic_allocator<char>>) return T(&this->values);
+            else return T();
+        }
+
+        /** Returns the value of the entry converted to T, or a null pointer if it wasn't converted to T yet. */
+        template <typename T>
+        const T *find(std::size_t entry) const
+        {
+            const std::atomic<const Node *> *heads = this->chunks[entry / chunk_size].load(std::memory_order_acquire);
+
+            if (heads == nullptr) return nullptr;
+
+            for (const Node *node = heads[entry % chunk_size].load(std::memory_order_acquire); node != nullptr;
+                 node = node->next)
+            {
+                if (const T *value = std::get_if<T>(&node->value)) return value;
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Adds a conversion of the entry, which has to come from make_value(). If another thread added the same type
+         * first, its value is returned.
+         */
+        template <typename T>
+        const T *insert(std::size_t entry, T value) const
+        {
+            return std::get_if<T>(this->insert_value(entry, TypedValue(std::move(value))));
+        }
+
+private:
+        struct Node
+        {
+            TypedValue value;
+            const Node *next;
+        };
+
+        using Heads = std::atomic<const Node *>;
+
+        static constexpr std::size_t chunk_size = 256;
+
+        const TypedValue *insert_value(std::size_t entry, TypedValue value) const;
+
+        std::pmr::memory_resource *resource;
+        mutable BumpArena values;               // Of the heads, lists and values, which the reading threads add.
+        std::atomic<Heads *> *chunks = nullptr; // Heads of chunk_size entries, or a null pointer until one is read.
+        std::size_t count = 0;
+};
+}
+
+#endif // HEADER_VALUE_CACHE_HPP_AP_17102026
@@ -0,0 +1,71 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    valueConversion.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Conversion of the values of a configuration file into the supported data types.
+ *
+ * The converted values are kept in a tagged store, so a value only has to be converted once. The store keeps strings
+ * and arrays in the std::pmr containers, so their memory comes from the arena of the loaded configuration.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_VALUE_CONVERSION_HPP_AP_17102026
+#define HEADER_VALUE_CONVERSION_HPP_AP_17102026
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+
+namespace SPFR
+{
+/** @brief One already converted value. The type of the held alternative is the type it was converted to. */
+using TypedValue = std::variant<std::monostate, int, float, bool, char, std::pmr::string, std::pmr::vector<int>,
+                                std::pmr::vector<float>, std::pmr::vector<char>,
+                                std::pmr::vector<std::pmr::string>>;
+
+/** @brief Type in which a value read as T is stored, the std::pmr container for strings and arrays. */
+template <typename T> struct StoredType { using type = T; };
+template <> struct StoredType<std::string> { using type = std::pmr::string; };
+template <typename T> struct StoredType<std::vector<T>>
+{
+        using type = std::pmr::vector<typename StoredType<T>::type>;
+};
+
+template <typename T> using Stored = typename StoredType<T>::type;
+
+/**
+ *  @brief Converts the text of a value into the requested type.
+ *
+ *  Numbers have to use the whole text, "12abc" is no valid integer. Arrays are enclosed in (), [] or {} and their
+ *  fields are separated by commata, spaces and brackets around the fields are ignored. If an array has an invalid
+ *  field, the returned vector holds the valid fields in front of it, so its size is the index of that field. The
+ *  std::pmr overloads take the memory of the result from the resource of the passed container.
+ *
+ *  @return False if the text is not a valid value of the type.
+ */
+bool parse_value(std::string_view text, int &value);
+bool parse_value(std::string_view text, float &value);
+bool parse_value(std::string_view text, bool &value);
+bool parse_value(std::string_view text, char &value);
+bool parse_value(std::string_view text, std::string &value);
+bool parse_value(std::string_view text, std::vector<int> &values);
+bool parse_value(std::string_view text, std::vector<float> &values);
+bool parse_value(std::string_view text, std::vector<char> &values);
+bool parse_value(std::string_view text, std::vector<std::string> &values);
+bool parse_value(std::string_view text, std::pmr::string &value);
+bool parse_value(std::string_view text, std::pmr::vector<int> &values);
+bool parse_value(std::string_view text, std::pmr::vector<float> &values);
+bool parse_value(std::string_view text, std::pmr::vector<char> &values);
+bool parse_value(std::string_view text, std::pmr::vector<std::pmr::string> &values);
+}
+
+#endif // HEADER_VALUE_CONVERSION_HPP_AP_17102026
@@ -0,0 +1,134 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    compactStore.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Names and values of a configuration in one pool of bytes, with a small index.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+
+#include "compactStore.hpp"
+
+
+namespace SPFR
+{
+
+bool CompactStore::reserve(std::size_t entry_count, std::size_t text_size)
+{
+    // The offsets into the pool have 32 bits, the entry numbers leave at least one bit of the hash in a slot.
+    if (text_size > 0xFFFFFFFFu || entry_count >= name_size_mask) return false;
+
+    // The memory of an arena is taken once and not for every growth. The pool has one byte more, which the copy
+    // without spaces may overwrite behind the last value.
+    this->pool.clear();
+    this->pool.resize(text_size + 1);
+    this->entries.clear();
+    this->entries.reserve(entry_count + 1);
+    this->entries.push_back(Entry{0, 0});
+
+    // At most four of five slots are used, so a search ends after a few slots even for a missing name.
+    this->slots.assign(entry_count + entry_count / 4 + 1, 0);
+    this->entry_mask = 1;
+
+    while (this->entry_mask < entry_count) this->entry_mask = 2 * this->entry_mask + 1;
+
+    return true;
+}
+
+bool CompactStore::add(std::string_view name, std::uint64_t name_hash, std::string_view value)
+{
+    std::size_t end = this->entries.back().offset;
+
+    // The reserved memory is never exceeded, and one slot stays free, so every search ends.
+    if (this->size() >= this->entry_mask || this->size() + 1 >= this->slots.size() || name.size() > name_size_mask)
+    {
+        return false;
+    }
+
+    // The spaces are only counted at the end of the pool, where the value with them may not fit anymore.
+    if (end + name.size() + value.size() >= this->pool.size() &&
+        end + name.size() + value.size() - static_cast<std::size_t>(std::count(value.begin(), value.end(), ' ')) >=
+        this->pool.size())
+    {
+        return false;
+    }
+
+    std::uint64_t h = mix(name_hash);
+    std::uint32_t hash_bits = static_cast<std::uint32_t>(h) & ~this->entry_mask;
+    std::size_t i = static_cast<std::size_t>(((h >> 32) * this->slots.size()) >> 32);
+
+    for (; this->slots[i] != 0; i = (i + 1 == this->slots.size()) ? 0 : i + 1)
+    {
+        std::uint32_t slot = this->slots[i];
+
+        // The first entry of a name wins.
+        if ((slot & ~this->entry_mask) == hash_bits && this->name((slot & this->entry_mask) - 1) == name) return false;
+    }
+
+    std::uint32_t entry = static_cast<std::uint32_t>(this->size());
+    bool array = !value.empty() && (value[0] == '[' || value[0] == '(' || value[0] == '{');
+
+    this->entries.back().tag = static_cast<std::uint32_t>(name.size()) | (array ? array_value : 0);
+
+    char *text = this->pool.data() + end;
+
+    std::memcpy(text, name.data(), name.size());
+    text += name.size();
+
+    // Mostly the tokenizer removed the spaces already, only arrays of a mapped file and lazily split values have some.
+    // Every character is written and a space is overwritten by the next one, which needs no branch.
+    if (value.find(' ') == std::string_view::npos)
+    {
+        std::memcpy(text, value.data(), value.size());
+        text += value.size();
+    }
+    else
+    {
+        for (char c : value)
+        {
+            *text = c;
+            text += (c != ' ');
+        }
+    }
+
+    this->entries.push_back(Entry{static_cast<std::uint32_t>(text - this->pool.data()), 0});
+    this->slots[i] = hash_bits | (entry + 1);
+
+    return true;
+}
+
+std::uint32_t CompactStore::find(std::string_view name, std::uint64_t name_hash) const
+{
+    if (this->slots.empty()) return npos;
+
+    std::uint64_t h = mix(name_hash);
+    std::uint32_t hash_bits = static_cast<std::uint32_t>(h) & ~this->entry_mask;
+    std::size_t i = static_cast<std::size_t>(((h >> 32) * this->slots.size()) >> 32);
+
+    for (; this->slots[i] != 0; i = (i + 1 == this->slots.size()) ? 0 : i + 1)
+    {
+        std::uint32_t slot = this->slots[i];
+
+        if ((slot & ~this->entry_mask) != hash_bits) continue;
+
+        const Entry &entry = this->entries[(slot & this->entry_mask) - 1];
+
+        if ((entry.tag & name_size_mask) == name.size() &&
+            std::memcmp(this->pool.data() + entry.offset, name.data(), name.size()) == 0)
+        {
+            return (slot & this->entry_mask) - 1;
+        }
+    }
+
+    return npos;
+}
+
+}
@@ -0,0 +1,110 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configArena.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Memory of one loaded configuration, which is taken in a few large blocks and freed in one step.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include "configArena.hpp"
+
+
+namespace SPFR
+{
+
+ConfigArena::ConfigArena(std::pmr::memory_resource *upstream) : blocks(first_block_size, upstream)
+{
+
+}
+
+std::size_t ConfigArena::size() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    return this->allocated;
+}
+
+void *ConfigArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    void *memory = this->blocks.allocate(bytes, alignment);
+    this->allocated += bytes;
+
+    return memory;
+}
+
+void ConfigArena::do_deallocate(void *, std::size_t, std::size_t)
+{
+    // The memory is given back with the whole arena.
+}
+
+bool ConfigArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+void *BumpArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    // Bigger values take their own memory, so a block isn't left mostly empty.
+    if (bytes > max_block_size / 4) return this->upstream->allocate(bytes, alignment);
+
+    Block *block = this->current.load(std::memory_order_acquire);
+
+    for (;;)
+    {
+        if (block != nullptr)
+        {
+            std::uintptr_t data = reinterpret_cast<std::uintptr_t>(block + 1);
+            std::size_t used = block->used.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                std::size_t begin = ((data + used + alignment - 1) & ~(std::uintptr_t(alignment) - 1)) - data;
+
+                if (begin + bytes > block->size) break;
+
+                if (block->used.compare_exchange_weak(used, begin + bytes, std::memory_order_relaxed))
+                {
+                    return reinterpret_cast<char *>(block + 1) + begin;
+                }
+            }
+        }
+
+        std::size_t size = (block == nullptr) ? first_block_size : std::min(2 * block->size, max_block_size);
+
+        while (size < bytes + alignment) size = 2 * size;
+
+        void *memory = this->upstream->allocate(sizeof(Block) + size, alignof(std::max_align_t));
+        Block *fresh = new (memory) Block{size, {0}};
+
+        // If another thread added a block in the meantime, its block is used and this one stays unused in the
+        // upstream resource.
+        if (this->current.compare_exchange_strong(block, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            block = fresh;
+        }
+    }
+}
+
+void BumpArena::do_deallocate(void *, std::size_t, std::size_t)
+{
+    // The memory is given back with the upstream resource.
+}
+
+bool BumpArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+}
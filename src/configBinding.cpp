@@ -0,0 +1,69 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configBinding.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Registry of parameters which are read together.
+ *
+ * Registering only stores the name and the address of the variable. The file is read by ReadConfig::resolve().
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "configBinding.hpp"
+
+
+namespace SPFR
+{
+
+void ConfigBinding::bind(std::string str_value_name, std::string &str_value)
+{
+    this->entries.push_back(Binding{std::move(str_value_name), &str_value});
+}
+
+void ConfigBinding::bind(std::string char_value_name, char &char_value)
+{
+    this->entries.push_back(Binding{std::move(char_value_name), &char_value});
+}
+
+void ConfigBinding::bind(std::string int_value_name, int &int_value)
+{
+    this->entries.push_back(Binding{std::move(int_value_name), &int_value});
+}
+
+void ConfigBinding::bind(std::string float_value_name, float &float_value)
+{
+    this->entries.push_back(Binding{std::move(float_value_name), &float_value});
+}
+
+void ConfigBinding::bind(std::string bool_value_name, bool &bool_value)
+{
+    this->entries.push_back(Binding{std::move(bool_value_name), &bool_value});
+}
+
+void ConfigBinding::bind(std::string int_arr_value_name, int *int_arr_value, int int_arr_size)
+{
+    this->entries.push_back(Binding{std::move(int_arr_value_name), Array<int>{int_arr_value, int_arr_size}});
+}
+
+void ConfigBinding::bind(std::string float_arr_value_name, float *float_arr_value, int float_arr_size)
+{
+    this->entries.push_back(Binding{std::move(float_arr_value_name), Array<float>{float_arr_value, float_arr_size}});
+}
+
+void ConfigBinding::bind(std::string char_arr_value_name, char *char_arr_value, int char_arr_size)
+{
+    this->entries.push_back(Binding{std::move(char_arr_value_name), Array<char>{char_arr_value, char_arr_size}});
+}
+
+void ConfigBinding::bind(std::string str_arr_value_name, std::string *str_array_value, int str_arr_size)
+{
+    this->entries.push_back(Binding{std::move(str_arr_value_name),
+                                    Array<std::string>{str_array_value, str_arr_size}});
+}
+
+}
@@ -0,0 +1,288 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configBlocks.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Blocks of lines with checksums, so a reload only tokenizes the changed parts of a file.
+ *
+ * Tokens never cross a line end, so the tokens of the blocks in their order are the tokens of the whole file. The
+ * tokens of an unchanged block are moved from the text of the previous version to the same place in the new text.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include "configBlocks.hpp"
+#include "configSnapshot.hpp"
+#include "configTokenizer.hpp"
+#include "keyIndex.hpp"
+
+
+namespace SPFR
+{
+namespace
+{
+
+// A block ends behind one of 64 lines on average and behind 1024 lines at the latest.
+constexpr std::uint64_t block_mask = 63;
+constexpr std::size_t max_block_lines = 1024;
+
+// Below this size a part of the changed blocks costs more for its thread than it saves.
+constexpr std::size_t min_part_size = 1 << 20;
+
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+std::uint64_t mix(std::uint64_t hash, std::uint64_t word)
+{
+    hash = (hash ^ word) * 0xFF51AFD7ED558CCDull;
+
+    return hash ^ (hash >> 32);
+}
+
+// Hashes eight bytes at once. The checksums only have to notice edits, they don't have to resist attacks.
+std::uint64_t hash_bytes(const char *data, std::size_t size)
+{
+    std::uint64_t hash = size * 0x9E3779B97F4A7C15ull;
+    std::uint64_t word;
+
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        std::memcpy(&word, data, 8);
+        hash = mix(hash, word);
+    }
+
+    if (size > 0)
+    {
+        word = 0;
+        std::memcpy(&word, data, size);
+        hash = mix(hash, word);
+    }
+
+    return hash;
+}
+
+// Text of a layer in the buffered or in the memory mapped load mode.
+const char *layer_text(const ConfigLayer &layer)
+{
+    return layer.buffer.empty() ? layer.mapped_file.data() : layer.buffer.data();
+}
+
+std::size_t token_count(const ConfigLayer &layer, std::size_t block)
+{
+    std::size_t last = layer.raw_config.size();
+
+    if (block + 1 < layer.blocks.size()) last = layer.blocks[block + 1].first_token;
+
+    return last - layer.blocks[block].first_token;
+}
+
+}
+
+void split_blocks(const char *text, std::size_t size, std::pmr::vector<TextBlock> &blocks)
+{
+    blocks.clear();
+
+    std::size_t begin = 0;
+    std::size_t position = 0;
+    std::size_t lines = 0;
+    std::uint64_t checksum = 0;
+
+    while (position < size)
+    {
+        const void *line_end = std::memchr(text + position, '\n', size - position);
+        std::size_t next = line_end ? static_cast<const char *>(line_end) - text + 1 : size;
+        std::uint64_t line_hash = hash_bytes(text + position, next - position);
+
+        checksum = mix(checksum, line_hash);
+        position = next;
+        lines++;
+
+        if ((line_hash & block_mask) == 0 || lines == max_block_lines || position == size)
+        {
+            blocks.push_back(TextBlock{begin, position - begin, mix(checksum, position - begin), 0});
+
+            begin = position;
+            checksum = 0;
+            lines = 0;
+        }
+    }
+}
+
+std::size_t tokenize_blocks(ConfigLayer &layer, const ConfigLayer *previous, unsigned thread_count)
+{
+    // The buffered load mode compacts the tokens in place, the memory mapped one copies them into the spills.
+    char *buffer = layer.buffer.empty() ? nullptr : &layer.buffer[0];
+    const char *text = layer_text(layer);
+    std::pmr::vector<TextBlock> &blocks = layer.blocks;
+
+    // The block of the previous version with the same content, for every block.
+    std::vector<std::size_t> sources(blocks.size(), npos);
+
+    if (previous != nullptr)
+    {
+        std::unordered_map<std::uint64_t, std::size_t> previous_blocks(previous->blocks.size());
+
+        for (std::size_t i = 0; i < previous->blocks.size(); i++)
+        {
+            previous_blocks.emplace(previous->blocks[i].checksum, i);
+        }
+
+        for (std::size_t i = 0; i < blocks.size(); i++)
+        {
+            auto found = previous_blocks.find(blocks[i].checksum);
+
+            if (found != previous_blocks.end() && previous->blocks[found->second].size == blocks[i].size)
+            {
+                sources[i] = found->second;
+            }
+        }
+    }
+
+    std::vector<std::size_t> changed;
+    std::size_t changed_size = 0;
+
+    for (std::size_t i = 0; i < blocks.size(); i++)
+    {
+        if (sources[i] != npos) continue;
+
+        changed.push_back(i);
+        changed_size += blocks[i].size;
+    }
+
+    // The changed blocks are cut into parts of about the same size. Every part has its own thread and spill storage,
+    // the last spill storage keeps the copied tokens of the unchanged blocks.
+    std::size_t part_count = std::max<std::size_t>(1, std::min<std::size_t>(thread_count,
+                                                                            changed_size / min_part_size));
+    std::vector<std::size_t> bounds(part_count + 1, changed.size());
+    std::vector<std::pmr::vector<std::string_view>> block_tokens(changed.size());
+
+    bounds[0] = 0;
+
+    for (std::size_t c = 0, part = 1, bytes = 0; c < changed.size(); c++)
+    {
+        while (part < part_count && bytes >= changed_size * part / part_count) bounds[part++] = c;
+
+        bytes += blocks[changed[c]].size;
+    }
+
+    layer.spills.assign(part_count + 1, std::pmr::deque<std::pmr::string>());
+
+    auto tokenize_part = [&](std::size_t part)
+    {
+        for (std::size_t c = bounds[part]; c < bounds[part + 1]; c++)
+        {
+            const TextBlock &block = blocks[changed[c]];
+
+            const char *begin = text + block.begin;
+
+            if (layer.lazy_values) tokenize_config_lazy(begin, block.size, block_tokens[c], layer.spills[part]);
+            else if (buffer != nullptr) tokenize_config(buffer + block.begin, block.size, block_tokens[c]);
+            else tokenize_config(begin, block.size, block_tokens[c], layer.spills[part]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t part = 1; part < part_count; part++) threads.emplace_back(tokenize_part, part);
+
+    tokenize_part(0);
+
+    for (std::thread &thread : threads) thread.join();
+
+    // Put the tokens of all blocks together in the order of the file.
+    std::pmr::vector<std::string_view> &tokens = layer.raw_config;
+    std::size_t total = 0;
+
+    for (std::size_t i = 0, c = 0; i < blocks.size(); i++)
+    {
+        total += (sources[i] == npos) ? block_tokens[c++].size() : token_count(*previous, sources[i]);
+    }
+
+    tokens.clear();
+    tokens.reserve(total);
+
+    const char *previous_text = previous ? layer_text(*previous) : nullptr;
+    std::less<const char *> before;
+
+    for (std::size_t i = 0, c = 0; i < blocks.size(); i++)
+    {
+        TextBlock &block = blocks[i];
+
+        block.first_token = tokens.size();
+
+        if (sources[i] == npos)
+        {
+            tokens.insert(tokens.end(), block_tokens[c].begin(), block_tokens[c].end());
+            std::pmr::vector<std::string_view>().swap(block_tokens[c++]);
+            continue;
+        }
+
+        // The compacted tokens of the buffered mode are copied with the block. A view into the block of the previous
+        // text moves to the same place in the new text, a spilled token is copied.
+        const TextBlock &source = previous->blocks[sources[i]];
+        const char *source_begin = previous_text + source.begin;
+        const char *source_end = source_begin + source.size;
+
+        if (buffer != nullptr) std::memcpy(buffer + block.begin, source_begin, block.size);
+
+        for (std::size_t k = 0, count = token_count(*previous, sources[i]); k < count; k++)
+        {
+            std::string_view token = previous->raw_config[source.first_token + k];
+
+            if (!before(token.data(), source_begin) && !before(source_end, token.data()))
+            {
+                tokens.emplace_back(text + block.begin + (token.data() - source_begin), token.size());
+            }
+            else
+            {
+                layer.spills.back().emplace_back(token);
+                tokens.emplace_back(layer.spills.back().back());
+            }
+        }
+    }
+
+    // A new file is hashed later on all threads. Otherwise the names of the unchanged blocks keep their hashes, as
+    // long as they are still names, i.e. the block starts on an even position in both versions.
+    layer.hashes.clear();
+
+    if (previous == nullptr) return changed_size;
+
+    layer.hashes.resize(tokens.size() / 2);
+
+    for (std::size_t i = 0; i < blocks.size(); i++)
+    {
+        std::size_t count = token_count(layer, i);
+
+        for (std::size_t k = 0; k < count; k++)
+        {
+            std::size_t name = blocks[i].first_token + k;
+
+            if (name % 2 != 0 || name / 2 >= layer.hashes.size()) continue;
+
+            std::size_t source_name = (sources[i] == npos) ? npos : previous->blocks[sources[i]].first_token + k;
+
+            if (source_name != npos && source_name % 2 == 0 && source_name / 2 < previous->hashes.size())
+            {
+                layer.hashes[name / 2] = previous->hashes[source_name / 2];
+            }
+            else
+            {
+                layer.hashes[name / 2] = KeyIndex::hash(tokens[name]);
+            }
+        }
+    }
+
+    return changed_size;
+}
+
+}
@@ -0,0 +1,532 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configImage.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Compiled binary image of a configuration file.
+ *
+ * The compiler resolves the includes and converts every value to every type it is valid for, with the same rules and
+ * conversion functions as the text reader, so a compiled configuration returns exactly what the text file would return.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <utility>
+
+#include "configImage.hpp"
+#include "configTokenizer.hpp"
+#include "keyIndex.hpp"
+
+
+namespace SPFR
+{
+namespace
+{
+// The tokens of a configuration file and of the files it includes, in the order of read_includes().
+struct CompileLayers
+{
+    std::deque<MappedFile> files;
+    std::deque<std::pmr::deque<std::pmr::string>> spills;
+    std::map<std::string, std::pmr::vector<std::string_view>> tokens;
+    std::vector<const std::pmr::vector<std::string_view> *> order;
+};
+
+// Maps the file with the checks of the text reader and tokenizes it without copying it.
+bool read_layer(const std::string &file_name, CompileLayers &layers, std::vector<std::string> &includes,
+                std::string &error)
+{
+    // A file which is included twice is only read once.
+    if (layers.tokens.count(file_name) == 0)
+    {
+        MappedFile &file = layers.files.emplace_back();
+
+        if (!file.open(file_name, error))
+        {
+            error = "Cannot read the configuration file " + file_name + ". " + error;
+            return false;
+        }
+
+        std::pmr::vector<std::string_view> &tokens = layers.tokens[file_name];
+
+        tokenize_config(file.data(), file.size(), tokens, layers.spills.emplace_back());
+
+        // The text reader warns and reads the values shifted, an image would keep them for good.
+        if (tokens.size() % 2 != 0)
+        {
+            error = "The configuration file " + file_name + " has a name without a value.";
+            return false;
+        }
+    }
+
+    find_includes(file_name, layers.tokens[file_name], includes);
+
+    return true;
+}
+}
+
+struct ConfigImage::Header
+{
+    char magic[8];
+    std::uint32_t byte_order;
+    std::uint32_t format_version;
+    std::uint32_t entry_count;
+    std::uint32_t slot_count;
+    std::uint64_t entries_offset;
+    std::uint64_t slots_offset;
+    std::uint64_t arrays_offset;
+    std::uint64_t array_fields;                 // Number of 4 byte fields in the array section.
+    std::uint64_t strings_offset;
+    std::uint64_t strings_size;
+    std::uint64_t generation;                   // 0 for an image file, counted from 1 for a published one.
+};
+
+struct ConfigImage::Entry
+{
+    std::uint64_t key_hash;
+    std::uint32_t key_offset;
+    std::uint32_t key_size;
+    std::uint32_t text_offset;
+    std::uint32_t text_size;
+    std::uint32_t int_array_offset;             // Offsets of the arrays in fields, not in bytes.
+    std::uint32_t float_array_offset;
+    std::uint32_t array_size;
+    int int_value;
+    float float_value;
+    std::uint8_t flags;                         // Which of the values are valid.
+    char char_value;
+    bool bool_value;
+    std::uint8_t reserved;
+};
+
+namespace
+{
+
+const char image_magic[8] = "SPFRIMG";
+const std::uint32_t byte_order_mark = 0x01020304u;
+
+// Types the text of an entry could be converted to.
+const std::uint8_t has_int = 1;
+const std::uint8_t has_float = 2;
+const std::uint8_t has_bool = 4;
+const std::uint8_t has_char = 8;
+const std::uint8_t has_int_array = 16;
+const std::uint8_t has_float_array = 32;
+
+static_assert(sizeof(int) == 4 && std::numeric_limits<float>::is_iec559, "The image stores 4 byte numbers.");
+
+std::uint64_t align(std::uint64_t offset)
+{
+    return (offset + 7) & ~std::uint64_t(7);
+}
+
+// True if count elements of the given size starting at offset are part of an image of image_size bytes.
+bool fits(std::uint64_t offset, std::uint64_t count, std::uint64_t element_size, std::uint64_t image_size)
+{
+    return offset <= image_size && count <= (image_size - offset) / element_size;
+}
+
+}
+
+bool ConfigImage::compile(const std::string &config_file_name, const std::string &image_file_name,
+                          std::string &error)
+{
+    return compile(config_file_name, image_file_name, 0, error);
+}
+
+bool ConfigImage::publish(const std::string &config_file_name, const std::string &shared_name, std::string &error)
+{
+    std::string path = shared_path(shared_name);
+
+    if (path.empty())
+    {
+        error = "The shared memory name " + shared_name + " has to start with a '/' and can't have another one.";
+        return false;
+    }
+
+    // The attached processes compare the generations, an image of another format starts again with 1.
+    ConfigImage published;
+    std::string ignored;
+    std::uint64_t generation = published.open(path, ignored) ? published.generation() + 1 : 1;
+
+    published.close();
+
+    return compile(config_file_name, path, generation, error);
+}
+
+std::string ConfigImage::shared_path(const std::string &shared_name)
+{
+    if (shared_name.size() < 2 || shared_name[0] != '/' || shared_name.find('/', 1) != std::string::npos) return "";
+
+    return shared_memory_directory + shared_name;
+}
+
+bool ConfigImage::compile(const std::string &config_file_name, const std::string &image_file_name,
+                          std::uint64_t generation, std::string &error)
+{
+    CompileLayers layers;
+
+    auto read_file = [&](const std::string &file_name, std::vector<std::string> &includes)
+    {
+        return read_layer(file_name, layers, includes, error);
+    };
+
+    auto add_file = [&](const std::string &file_name) { layers.order.push_back(&layers.tokens[file_name]); };
+
+    if (!read_includes(config_file_name, read_file, add_file, error)) return false;
+
+    // The file with the highest priority comes last, as in the text reader, and the first entry of a name wins.
+    std::vector<std::pair<std::string_view, std::string_view>> parameters;
+
+    for (auto layer = layers.order.rbegin(); layer != layers.order.rend(); ++layer)
+    {
+        // Names are on the even positions, values follow directly.
+        for (std::size_t i = 0; i + 1 < (*layer)->size(); i = i + 2)
+        {
+            if ((**layer)[i] != include_directive) parameters.emplace_back((**layer)[i], (**layer)[i + 1]);
+        }
+    }
+
+    KeyIndex names;
+    std::vector<Entry> entries;
+    std::vector<std::uint32_t> arrays;
+    std::string strings;
+
+    names.reserve(parameters.size());
+
+    for (std::size_t i = 0; i < parameters.size(); i++)
+    {
+        std::string_view name = parameters[i].first;
+        std::string_view text = parameters[i].second;
+        std::uint64_t key_hash = KeyIndex::hash(name);
+
+        if (!names.insert(name, key_hash, static_cast<std::uint32_t>(i))) continue;
+
+        Entry entry{};
+        std::vector<int> int_array;
+        std::vector<float> float_array;
+
+        entry.key_hash = key_hash;
+        entry.key_offset = static_cast<std::uint32_t>(strings.size());
+        entry.key_size = static_cast<std::uint32_t>(name.size());
+        strings.append(name.data(), name.size());
+        entry.text_offset = static_cast<std::uint32_t>(strings.size());
+        entry.text_size = static_cast<std::uint32_t>(text.size());
+        strings.append(text.data(), text.size());
+
+        if (parse_value(text, entry.int_value)) entry.flags |= has_int;
+        if (parse_value(text, entry.float_value)) entry.flags |= has_float;
+        if (parse_value(text, entry.bool_value)) entry.flags |= has_bool;
+        if (parse_value(text, entry.char_value)) entry.flags |= has_char;
+
+        if (parse_value(text, int_array))
+        {
+            entry.flags |= has_int_array;
+            entry.int_array_offset = static_cast<std::uint32_t>(arrays.size());
+            entry.array_size = static_cast<std::uint32_t>(int_array.size());
+            arrays.insert(arrays.end(), int_array.begin(), int_array.end());
+        }
+
+        // Both arrays come from the same fields, so they have the same size if both are valid.
+        if (parse_value(text, float_array))
+        {
+            entry.flags |= has_float_array;
+            entry.float_array_offset = static_cast<std::uint32_t>(arrays.size());
+            entry.array_size = static_cast<std::uint32_t>(float_array.size());
+            arrays.resize(arrays.size() + float_array.size());
+
+            if (!float_array.empty())
+            {
+                std::memcpy(arrays.data() + entry.float_array_offset, float_array.data(),
+                            float_array.size() * sizeof(float));
+            }
+        }
+
+        if (strings.size() > npos || arrays.size() > npos)
+        {
+            error = "The configuration file is too big for an image.";
+            return false;
+        }
+
+        entries.push_back(entry);
+    }
+
+    // Hash table with at least twice as many slots as entries, so every probe sequence is short and ends empty.
+    std::uint32_t slot_count = 2;
+
+    while (slot_count < 2 * entries.size()) slot_count = slot_count * 2;
+
+    std::vector<std::uint32_t> slots(slot_count, npos);
+
+    for (std::uint32_t i = 0; i < entries.size(); i++)
+    {
+        std::uint32_t slot = static_cast<std::uint32_t>(entries[i].key_hash) & (slot_count - 1);
+
+        while (slots[slot] != npos) slot = (slot + 1) & (slot_count - 1);
+
+        slots[slot] = i;
+    }
+
+    Header header{};
+
+    std::memcpy(header.magic, image_magic, sizeof(image_magic));
+    header.byte_order = byte_order_mark;
+    header.format_version = format_version;
+    header.generation = generation;
+    header.entry_count = static_cast<std::uint32_t>(entries.size());
+    header.slot_count = slot_count;
+    header.entries_offset = align(sizeof(Header));
+    header.slots_offset = align(header.entries_offset + entries.size() * sizeof(Entry));
+    header.arrays_offset = align(header.slots_offset + slots.size() * sizeof(std::uint32_t));
+    header.array_fields = arrays.size();
+    header.strings_offset = align(header.arrays_offset + arrays.size() * sizeof(std::uint32_t));
+    header.strings_size = strings.size();
+
+    // Write next to the target and rename it, so a reader never maps a half written image.
+    std::string temporary_name = image_file_name + ".tmp";
+    std::ofstream image(temporary_name, std::ios::binary | std::ios::trunc);
+    std::uint64_t written = 0;
+
+    auto write = [&](std::uint64_t offset, const void *data, std::uint64_t size)
+    {
+        static const char zeros[8] = {};
+
+        image.write(zeros, static_cast<std::streamsize>(offset - written));
+        image.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        written = offset + size;
+    };
+
+    write(0, &header, sizeof(Header));
+    write(header.entries_offset, entries.data(), entries.size() * sizeof(Entry));
+    write(header.slots_offset, slots.data(), slots.size() * sizeof(std::uint32_t));
+    write(header.arrays_offset, arrays.data(), arrays.size() * sizeof(std::uint32_t));
+    write(header.strings_offset, strings.data(), strings.size());
+    image.close();
+
+    if (!image)
+    {
+        error = "Cannot write the image file " + temporary_name + ".";
+        std::remove(temporary_name.c_str());
+        return false;
+    }
+
+    if (std::rename(temporary_name.c_str(), image_file_name.c_str()) != 0)
+    {
+        error = std::strerror(errno);
+        std::remove(temporary_name.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool ConfigImage::open(const std::string &image_file_name, std::string &error)
+{
+    this->close();
+
+    if (!this->file.open(image_file_name, error, MappedFile::Access::Random)) return false;
+
+    const char *base = this->file.data();
+    std::uint64_t size = this->file.size();
+    const Header *header = reinterpret_cast<const Header *>(base);
+
+    if (size < sizeof(Header) || std::memcmp(header->magic, image_magic, sizeof(image_magic)) != 0 ||
+        header->byte_order != byte_order_mark)
+    {
+        error = "The file is not a compiled configuration of this machine.";
+        this->close();
+        return false;
+    }
+
+    if (header->format_version != format_version)
+    {
+        error = "The image has the format version " + std::to_string(header->format_version) + ", but version " +
+                std::to_string(format_version) + " is required. Compile the configuration again.";
+        this->close();
+        return false;
+    }
+
+    bool sections_valid =
+            header->entries_offset % 8 == 0 && header->slots_offset % 4 == 0 && header->arrays_offset % 4 == 0 &&
+            header->slot_count > header->entry_count && (header->slot_count & (header->slot_count - 1)) == 0 &&
+            fits(header->entries_offset, header->entry_count, sizeof(Entry), size) &&
+            fits(header->slots_offset, header->slot_count, sizeof(std::uint32_t), size) &&
+            fits(header->arrays_offset, header->array_fields, sizeof(std::uint32_t), size) &&
+            fits(header->strings_offset, header->strings_size, 1, size);
+
+    if (!sections_valid)
+    {
+        error = "The image is damaged.";
+        this->close();
+        return false;
+    }
+
+    this->header = header;
+    this->entries = reinterpret_cast<const Entry *>(base + header->entries_offset);
+    this->slots = reinterpret_cast<const std::uint32_t *>(base + header->slots_offset);
+    this->arrays = reinterpret_cast<const std::uint32_t *>(base + header->arrays_offset);
+    this->strings = base + header->strings_offset;
+
+    return true;
+}
+
+void ConfigImage::close()
+{
+    this->file.close();
+    this->header = nullptr;
+    this->entries = nullptr;
+    this->slots = nullptr;
+    this->arrays = nullptr;
+    this->strings = nullptr;
+}
+
+std::uint32_t ConfigImage::size() const
+{
+    return this->is_open() ? this->header->entry_count : 0;
+}
+
+std::uint64_t ConfigImage::generation() const
+{
+    return this->is_open() ? this->header->generation : 0;
+}
+
+std::uint32_t ConfigImage::find(const ConfigKey &key) const
+{
+    if (!this->is_open()) return npos;
+
+    std::uint32_t mask = this->header->slot_count - 1;
+    std::uint32_t slot = static_cast<std::uint32_t>(key.hash()) & mask;
+
+    // A damaged table could have no empty slot, so the probing ends after one round at the latest.
+    for (std::uint32_t probe = 0; probe <= mask; probe++, slot = (slot + 1) & mask)
+    {
+        std::uint32_t entry = this->slots[slot];
+
+        if (entry >= this->header->entry_count) return npos;
+
+        const Entry &candidate = this->entries[entry];
+
+        if (candidate.key_hash == key.hash() && this->string_at(candidate.key_offset, candidate.key_size) == key.name())
+        {
+            return entry;
+        }
+    }
+
+    return npos;
+}
+
+std::string_view ConfigImage::name(std::uint32_t entry) const
+{
+    const Entry *record = this->entry_at(entry, 0);
+
+    return record ? this->string_at(record->key_offset, record->key_size) : std::string_view();
+}
+
+std::string_view ConfigImage::text(std::uint32_t entry) const
+{
+    const Entry *record = this->entry_at(entry, 0);
+
+    return record ? this->string_at(record->text_offset, record->text_size) : std::string_view();
+}
+
+bool ConfigImage::scalar(std::uint32_t entry, const int *&value) const
+{
+    const Entry *record = this->entry_at(entry, has_int);
+
+    if (record) value = &record->int_value;
+
+    return record != nullptr;
+}
+
+bool ConfigImage::scalar(std::uint32_t entry, const float *&value) const
+{
+    const Entry *record = this->entry_at(entry, has_float);
+
+    if (record) value = &record->float_value;
+
+    return record != nullptr;
+}
+
+bool ConfigImage::scalar(std::uint32_t entry, const bool *&value) const
+{
+    const Entry *record = this->entry_at(entry, has_bool);
+
+    // Only 0 and 1 are valid representations of a bool.
+    if (record == nullptr || *reinterpret_cast<const unsigned char *>(&record->bool_value) > 1) return false;
+
+    value = &record->bool_value;
+
+    return true;
+}
+
+bool ConfigImage::scalar(std::uint32_t entry, const char *&value) const
+{
+    const Entry *record = this->entry_at(entry, has_char);
+
+    if (record) value = &record->char_value;
+
+    return record != nullptr;
+}
+
+bool ConfigImage::convert(std::uint32_t entry, std::pmr::vector<int> &values) const
+{
+    const Entry *record = this->entry_at(entry, has_int_array);
+
+    if (record == nullptr || !fits(record->int_array_offset, record->array_size, 1, this->header->array_fields))
+    {
+        return false;
+    }
+
+    const std::uint32_t *fields = this->arrays + record->int_array_offset;
+
+    values.assign(fields, fields + record->array_size);
+
+    return true;
+}
+
+bool ConfigImage::convert(std::uint32_t entry, std::pmr::vector<float> &values) const
+{
+    const Entry *record = this->entry_at(entry, has_float_array);
+
+    if (record == nullptr || !fits(record->float_array_offset, record->array_size, 1, this->header->array_fields))
+    {
+        return false;
+    }
+
+    values.resize(record->array_size);
+
+    if (!values.empty())
+    {
+        std::memcpy(values.data(), this->arrays + record->float_array_offset, values.size() * sizeof(float));
+    }
+
+    return true;
+}
+
+const ConfigImage::Entry *ConfigImage::entry_at(std::uint32_t entry, std::uint8_t flag) const
+{
+    if (!this->is_open() || entry >= this->header->entry_count) return nullptr;
+
+    const Entry *record = this->entries + entry;
+
+    return (flag == 0 || (record->flags & flag) != 0) ? record : nullptr;
+}
+
+std::string_view ConfigImage::string_at(std::uint32_t offset, std::uint32_t size) const
+{
+    if (!fits(offset, size, 1, this->header->strings_size)) return std::string_view();
+
+    return std::string_view(this->strings + offset, size);
+}
+
+}
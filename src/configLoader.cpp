@@ -0,0 +1,133 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configLoader.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Loads configurations in the background on a small pool of threads.
+ *
+ * The threads wait on a condition variable for the next job. A job only constructs the reader, so all the rules of
+ * the load modes and options are the same as for a reader which is constructed directly.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <experimental/filesystem>
+#include <system_error>
+
+#include "configLoader.hpp"
+
+
+namespace SPFR
+{
+
+ConfigLoader::ConfigLoader(unsigned thread_count)
+{
+    if (thread_count == 0) thread_count = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned i = 0; i < thread_count; i++) this->threads.emplace_back(&ConfigLoader::run, this);
+}
+
+ConfigLoader::~ConfigLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex);
+        this->stopping = true;
+    }
+
+    this->queue_changed.notify_all();
+
+    for (std::thread &thread : this->threads) thread.join();
+}
+
+ConfigLoader::Pending ConfigLoader::load(std::string config_file_name, ReadOptions options)
+{
+    return this->start(Job([config_file_name = std::move(config_file_name), options = std::move(options)]()
+    {
+        return std::make_shared<ReadConfig>(config_file_name, options);
+    }));
+}
+
+ConfigLoader::Pending ConfigLoader::load(std::vector<std::string> config_file_names, ReadOptions options)
+{
+    return this->start(Job([config_file_names = std::move(config_file_names), options = std::move(options)]()
+    {
+        return std::make_shared<ReadConfig>(config_file_names, options);
+    }));
+}
+
+std::map<std::string, ConfigLoader::Pending> ConfigLoader::load_directory(const std::string &directory,
+                                                                          std::string &error, ReadOptions options)
+{
+    namespace filesystem = std::experimental::filesystem;
+
+    std::map<std::string, Pending> configs;
+    std::vector<filesystem::path> files;
+    std::error_code code;
+
+    for (filesystem::directory_iterator entry(directory, code), end; !code && entry != end; entry.increment(code))
+    {
+        const filesystem::path &path = entry->path();
+
+        if (path.extension() == config_extension && filesystem::is_regular_file(entry->status())) files.push_back(path);
+    }
+
+    if (code)
+    {
+        error = "Cannot read the directory " + directory + ": " + code.message();
+        return configs;
+    }
+
+    // The files are started in the order of their names, so the loads don't depend on the order of the directory.
+    std::sort(files.begin(), files.end());
+
+    for (const filesystem::path &path : files)
+    {
+        configs.emplace(path.filename().string(), this->load(path.string(), options));
+    }
+
+    return configs;
+}
+
+ConfigLoader::Pending ConfigLoader::start(Job job)
+{
+    Pending pending = job.get_future().share();
+
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex);
+        this->queue.push_back(std::move(job));
+    }
+
+    this->queue_changed.notify_one();
+
+    return pending;
+}
+
+void ConfigLoader::run()
+{
+    for (;;)
+    {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(this->queue_mutex);
+
+            this->queue_changed.wait(lock, [this]() { return this->stopping || !this->queue.empty(); });
+
+            // The waiting jobs are still run when the loader is destroyed, so no future stays without a value.
+            if (this->queue.empty()) return;
+
+            job = std::move(this->queue.front());
+            this->queue.pop_front();
+        }
+
+        // An exception of the load is stored in the future.
+        job();
+    }
+}
+
+}
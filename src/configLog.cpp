@@ -0,0 +1,111 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configLog.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Diagnostics of the configuration reader.
+ *
+ * The standard output is no longer flushed after every message, the stream flushes on its own.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "configLog.hpp"
+
+
+namespace SPFR
+{
+
+void ConfigLog::configure(LogMode mode, Severity level, LogCallback callback, std::size_t capacity)
+{
+    this->mode = (mode == LogMode::Callback && !callback) ? LogMode::Silent : mode;
+    this->level = level;
+    this->callback = std::move(callback);
+    this->capacity = capacity;
+}
+
+void ConfigLog::write(Severity severity, std::string_view parameter, std::string_view message) const
+{
+    if (!this->enabled(severity)) return;
+
+    switch (this->mode)
+    {
+        case LogMode::Stdout:
+        {
+            // Keep the lines of several reading threads apart.
+            std::lock_guard<std::mutex> lock(this->write_mutex);
+            std::cout << message << '\n';
+            break;
+        }
+
+        case LogMode::Buffered:
+        {
+            std::lock_guard<std::mutex> lock(this->write_mutex);
+
+            // A full buffer overwrites its oldest record, which is counted as dropped.
+            if (this->buffer.size() < this->capacity)
+            {
+                this->buffer.push_back(LogRecord{severity, std::string(parameter), std::string(message)});
+            }
+            else if (this->capacity > 0)
+            {
+                LogRecord &record = this->buffer[this->next];
+
+                record.severity = severity;
+                record.parameter.assign(parameter);
+                record.message.assign(message);
+                this->next = (this->next + 1) % this->capacity;
+                this->dropped_count++;
+            }
+            else
+            {
+                this->dropped_count++;
+            }
+            break;
+        }
+
+        case LogMode::Callback:
+            this->callback(severity, parameter, message);
+            break;
+
+        case LogMode::Silent:
+            break;
+    }
+}
+
+std::vector<LogRecord> ConfigLog::records() const
+{
+    std::lock_guard<std::mutex> lock(this->write_mutex);
+
+    std::vector<LogRecord> ordered;
+
+    ordered.reserve(this->buffer.size());
+    ordered.insert(ordered.end(), this->buffer.begin() + static_cast<std::ptrdiff_t>(this->next), this->buffer.end());
+    ordered.insert(ordered.end(), this->buffer.begin(), this->buffer.begin() + static_cast<std::ptrdiff_t>(this->next));
+
+    return ordered;
+}
+
+std::uint64_t ConfigLog::dropped() const
+{
+    std::lock_guard<std::mutex> lock(this->write_mutex);
+
+    return this->dropped_count;
+}
+
+void ConfigLog::clear()
+{
+    std::lock_guard<std::mutex> lock(this->write_mutex);
+
+    this->buffer.clear();
+    this->next = 0;
+    this->dropped_count = 0;
+}
+
+}
@@ -0,0 +1,252 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configSchema.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Declared set of the parameters of a configuration and their types.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+
+#include "configSchema.hpp"
+#include "configTokenizer.hpp"
+
+
+namespace SPFR
+{
+
+const char *ConfigSchema::type_name(ParameterType type)
+{
+    // Spaces are removed from the values of a file, so the names of the types have none.
+    static const char *const names[parameter_type_count] = {"string", "char", "int", "float", "bool", "int_array",
+                                                            "float_array", "char_array", "string_array"};
+
+    return names[static_cast<std::size_t>(type)];
+}
+
+bool ConfigSchema::assign(std::vector<Field> fields, std::string &error)
+{
+    std::size_t count = fields.size();
+
+    if (count >= single_name)
+    {
+        error = "The schema has too many parameters.";
+        return false;
+    }
+
+    std::vector<std::uint64_t> hashes(count);
+
+    for (std::size_t i = 0; i < count; i++) hashes[i] = KeyIndex::hash(fields[i].name);
+
+    // Names with the same hash would need the same slot. These are names which are declared twice, different names
+    // with the same 64 bit hash are refused as well.
+    std::vector<std::uint32_t> order(count);
+
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&hashes](std::uint32_t a, std::uint32_t b)
+    {
+        return hashes[a] < hashes[b];
+    });
+
+    for (std::size_t i = 1; i < count; i++)
+    {
+        const std::string &name = fields[order[i]].name;
+        const std::string &previous = fields[order[i - 1]].name;
+
+        if (hashes[order[i]] != hashes[order[i - 1]]) continue;
+
+        if (name == previous) error = "The parameter " + name + " is declared twice in the schema.";
+        else error = "The parameters " + previous + " and " + name + " of the schema have the same hash.";
+
+        return false;
+    }
+
+    // Two names per bucket on average keep the buckets small and leave enough buckets with one name to fill the
+    // last slots, where a seed for several names would take long to find.
+    std::size_t bucket_count = std::max<std::size_t>(1, count / 2);
+    std::vector<std::uint32_t> new_buckets(bucket_count, 0);
+    std::vector<std::uint32_t> slot_fields(count, npos);
+
+    // The fields sorted by their bucket, and the first field of every bucket.
+    std::vector<std::uint32_t> bucket_of(count);
+    std::vector<std::uint32_t> first(bucket_count + 1, 0);
+    std::vector<std::uint32_t> members(count);
+
+    for (std::uint32_t i = 0; i < count; i++)
+    {
+        bucket_of[i] = reduce(mix(hashes[i], 0), bucket_count);
+        first[bucket_of[i] + 1]++;
+    }
+
+    std::partial_sum(first.begin(), first.end(), first.begin());
+
+    std::vector<std::uint32_t> end(first.begin(), first.end() - 1);
+
+    for (std::uint32_t i = 0; i < count; i++) members[end[bucket_of[i]]++] = i;
+
+    // The biggest buckets are placed first, while most slots are still free.
+    std::vector<std::uint32_t> by_size(bucket_count);
+
+    std::iota(by_size.begin(), by_size.end(), 0u);
+    std::stable_sort(by_size.begin(), by_size.end(), [&first](std::uint32_t a, std::uint32_t b)
+    {
+        return first[a + 1] - first[a] > first[b + 1] - first[b];
+    });
+
+    std::size_t next = 0;
+    std::vector<std::uint32_t> taken;
+
+    for (; next < bucket_count && first[by_size[next] + 1] - first[by_size[next]] > 1; next++)
+    {
+        const std::uint32_t *bucket = members.data() + first[by_size[next]];
+        std::size_t bucket_size = first[by_size[next] + 1] - first[by_size[next]];
+
+        // Try the seeds until every name of the bucket lands on a free slot of its own.
+        for (std::uint32_t seed = 1;; seed++)
+        {
+            if (seed == single_name)
+            {
+                error = "No perfect hash was found for the names of the schema.";
+                return false;
+            }
+
+            taken.clear();
+
+            for (std::size_t k = 0; k < bucket_size; k++)
+            {
+                std::uint32_t slot = reduce(mix(hashes[bucket[k]], seed), count);
+
+                if (slot_fields[slot] != npos || std::find(taken.begin(), taken.end(), slot) != taken.end()) break;
+
+                taken.push_back(slot);
+            }
+
+            if (taken.size() < bucket_size) continue;
+
+            for (std::size_t k = 0; k < bucket_size; k++) slot_fields[taken[k]] = bucket[k];
+
+            new_buckets[by_size[next]] = seed;
+            break;
+        }
+    }
+
+    // The buckets with one name take the remaining slots directly.
+    std::uint32_t free_slot = 0;
+
+    for (; next < bucket_count && first[by_size[next] + 1] - first[by_size[next]] == 1; next++)
+    {
+        while (slot_fields[free_slot] != npos) free_slot++;
+
+        slot_fields[free_slot] = members[first[by_size[next]]];
+        new_buckets[by_size[next]] = single_name | free_slot;
+    }
+
+    // The slots are as long as the longest name needs, up to one cache line. Longer names are stored behind them.
+    std::size_t longest = 0;
+
+    for (const Field &field : fields) longest = std::max(longest, field.name.size());
+
+    std::size_t new_slot_words = std::min(max_slot_words, 2 + (longest + 7) / 8);
+    std::size_t inline_size = (new_slot_words - 2) * 8;
+
+    // The fields are stored in the order of the slots.
+    std::vector<Field> new_fields(count);
+    std::vector<std::uint32_t> new_declaration(count);
+    std::vector<std::uint64_t> new_slots(count * new_slot_words, 0);
+    std::string new_names;
+
+    for (std::uint32_t slot = 0; slot < count; slot++)
+    {
+        std::uint32_t field = slot_fields[slot];
+        const std::string &name = fields[field].name;
+        std::uint64_t *words = new_slots.data() + slot * new_slot_words;
+
+        if (name.size() > 0xFFFFFFFFu || new_names.size() > 0xFFFFFFFFu)
+        {
+            error = "The names of the schema are too long.";
+            return false;
+        }
+
+        words[0] = hashes[field];
+        words[1] = name.size();
+
+        if (name.size() <= inline_size)
+        {
+            std::memcpy(words + 2, name.data(), name.size());
+        }
+        else
+        {
+            words[1] |= static_cast<std::uint64_t>(new_names.size()) << 32;
+            new_names += name;
+        }
+
+        new_declaration[field] = slot;
+        new_fields[slot] = std::move(fields[field]);
+    }
+
+    this->fields = std::move(new_fields);
+    this->declaration = std::move(new_declaration);
+    this->buckets = std::move(new_buckets);
+    this->slots = std::move(new_slots);
+    this->slot_words = new_slot_words;
+    this->names = std::move(new_names);
+
+    return true;
+}
+
+bool ConfigSchema::read(const std::string &file_name, std::string &error)
+{
+    std::ifstream file(file_name, std::ios::binary);
+
+    if (!file)
+    {
+        error = "Cannot open the schema file " + file_name + ".";
+        return false;
+    }
+
+    // A schema file has the syntax of a configuration file, with the type as the value of every name.
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::pmr::vector<std::string_view> tokens;
+
+    tokenize_config(&text[0], text.size(), tokens);
+
+    if (tokens.size() % 2 != 0)
+    {
+        error = "The schema file " + file_name + " has a parameter without a type.";
+        return false;
+    }
+
+    std::vector<Field> new_fields;
+
+    new_fields.reserve(tokens.size() / 2);
+
+    for (std::size_t i = 0; i < tokens.size(); i = i + 2)
+    {
+        std::size_t type = 0;
+
+        while (type < parameter_type_count && tokens[i + 1] != type_name(static_cast<ParameterType>(type))) type++;
+
+        if (type == parameter_type_count)
+        {
+            error = "The parameter " + std::string(tokens[i]) + " of the schema file " + file_name +
+                    " has the unknown type " + std::string(tokens[i + 1]) + ".";
+            return false;
+        }
+
+        new_fields.push_back(Field{std::string(tokens[i]), static_cast<ParameterType>(type)});
+    }
+
+    return this->assign(std::move(new_fields), error);
+}
+
+}
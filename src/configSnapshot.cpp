@@ -0,0 +1,78 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configSnapshot.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   One loaded version of a configuration file and the publication of new versions.
+ *
+ * All atomic operations are sequentially consistent. The order "count the reader, check the epoch, load the pointer"
+ * against "swap the pointer, start the next epoch, wait" is what makes the grace period safe.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <thread>
+
+#include "configSnapshot.hpp"
+
+
+namespace SPFR
+{
+
+SnapshotDomain::~SnapshotDomain()
+{
+    delete this->current.load();
+}
+
+void SnapshotDomain::publish(std::unique_ptr<ConfigSnapshot> snapshot)
+{
+    ConfigSnapshot *old_snapshot = this->current.exchange(snapshot.release());
+
+    // Every reader which registered before the next epoch starts may still hold the old snapshot. Readers of the next
+    // epoch load the pointer after the swap, so they only get the new one.
+    unsigned old_epoch = this->epoch.fetch_add(1);
+
+    for (Stripe &stripe : this->stripes)
+    {
+        while (stripe.readers[old_epoch & 1].load() != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    delete old_snapshot;
+}
+
+SnapshotDomain::Guard::Guard(const SnapshotDomain &domain)
+{
+    // Threads get their stripes one after the other, so up to stripe_count threads never share a counter.
+    static std::atomic<std::size_t> next_stripe{0};
+    thread_local std::size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % stripe_count;
+
+    this->readers = domain.stripes[stripe].readers;
+
+    // Register in the counter of the current epoch. If a writer started a new epoch in the meantime, it might not
+    // wait for this counter, so register again in the new one.
+    for (;;)
+    {
+        this->epoch = domain.epoch.load();
+        this->readers[this->epoch & 1].fetch_add(1);
+
+        if (domain.epoch.load() == this->epoch) break;
+
+        this->readers[this->epoch & 1].fetch_sub(1);
+    }
+
+    this->snapshot = domain.current.load();
+}
+
+SnapshotDomain::Guard::~Guard()
+{
+    this->readers[this->epoch & 1].fetch_sub(1);
+}
+
+}
@@ -0,0 +1,271 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configStats.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Statistics about the loads and the lookups of a configuration.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+
+#include "configStats.hpp"
+
+
+namespace SPFR
+{
+namespace
+{
+
+const char *const type_names[parameter_type_count] = {"string", "char", "int", "float", "bool", "int array",
+                                                      "float array", "char array", "string array"};
+
+// Parameter names can contain every character except spaces, ':' and '#'.
+std::string json_string(const std::string &text)
+{
+    std::string escaped = "\"";
+
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", c);
+            escaped += code;
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+
+    return escaped + "\"";
+}
+
+void text_line(std::ostringstream &text, const LookupStats &stats)
+{
+    char line[160];
+    std::snprintf(line, sizeof(line), "  %-32s %12llu %12llu %12llu\n", stats.name.c_str(),
+                  static_cast<unsigned long long>(stats.lookups), static_cast<unsigned long long>(stats.misses),
+                  static_cast<unsigned long long>(stats.failures));
+    text << line;
+}
+
+void json_entry(std::ostringstream &json, const char *label, const LookupStats &stats)
+{
+    json << "{\"" << label << "\": " << json_string(stats.name) << ", \"lookups\": " << stats.lookups
+         << ", \"misses\": " << stats.misses << ", \"failures\": " << stats.failures << "}";
+}
+
+}
+
+StatsCollector::~StatsCollector()
+{
+    for (KeySlot &slot : this->keys) delete slot.name.load();
+}
+
+void StatsCollector::count_lookup(const ConfigKey &key, ParameterType type, bool missing, bool invalid)
+{
+    TypeCounters &counters = this->types[static_cast<std::size_t>(type)];
+
+    counters.lookups.fetch_add(1, std::memory_order_relaxed);
+
+    if (missing) counters.misses.fetch_add(1, std::memory_order_relaxed);
+    if (invalid) counters.failures.fetch_add(1, std::memory_order_relaxed);
+
+    KeySlot *slot = this->find_slot(key);
+
+    if (slot == nullptr)
+    {
+        this->untracked_lookups.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    slot->counters.lookups.fetch_add(1, std::memory_order_relaxed);
+
+    if (missing) slot->counters.misses.fetch_add(1, std::memory_order_relaxed);
+    if (invalid) slot->counters.failures.fetch_add(1, std::memory_order_relaxed);
+}
+
+StatsCollector::KeySlot *StatsCollector::find_slot(const ConfigKey &key)
+{
+    std::uint64_t tag = key.hash() | 1;
+
+    for (std::size_t probe = 0; probe < max_probes; probe++)
+    {
+        KeySlot &slot = this->keys[(key.hash() + probe) % max_tracked_keys];
+        std::uint64_t current = slot.tag.load(std::memory_order_acquire);
+
+        if (current == 0 && slot.tag.compare_exchange_strong(current, tag, std::memory_order_acq_rel))
+        {
+            slot.name.store(new std::string(key.name()), std::memory_order_release);
+            return &slot;
+        }
+
+        // Two names with the same tag are told apart by the name, which the other thread could still be setting.
+        if (current != tag) continue;
+
+        const std::string *name = slot.name.load(std::memory_order_acquire);
+
+        for (; name == nullptr; name = slot.name.load(std::memory_order_acquire)) std::this_thread::yield();
+
+        if (*name == key.name()) return &slot;
+    }
+
+    return nullptr;
+}
+
+void StatsCollector::count_load(const LoadStats &load, bool failed)
+{
+    std::lock_guard<std::mutex> lock(this->load_mutex);
+
+    this->loads++;
+
+    if (failed) this->failed_loads++;
+    else this->last_load = load;
+}
+
+ConfigStats StatsCollector::stats() const
+{
+    ConfigStats stats;
+
+    stats.enabled = true;
+
+    {
+        std::lock_guard<std::mutex> lock(this->load_mutex);
+
+        stats.loads = this->loads;
+        stats.failed_loads = this->failed_loads;
+        stats.last_load = this->last_load;
+    }
+
+    for (std::size_t i = 0; i < parameter_type_count; i++)
+    {
+        stats.types.push_back(LookupStats{type_names[i], this->types[i].lookups.load(std::memory_order_relaxed),
+                                          this->types[i].misses.load(std::memory_order_relaxed),
+                                          this->types[i].failures.load(std::memory_order_relaxed)});
+    }
+
+    for (const KeySlot &slot : this->keys)
+    {
+        const std::string *name = slot.name.load(std::memory_order_acquire);
+        std::uint64_t lookups = slot.counters.lookups.load(std::memory_order_relaxed);
+
+        if (name == nullptr || lookups == 0) continue;
+
+        stats.keys.push_back(LookupStats{*name, lookups, slot.counters.misses.load(std::memory_order_relaxed),
+                                         slot.counters.failures.load(std::memory_order_relaxed)});
+    }
+
+    stats.untracked_lookups = this->untracked_lookups.load(std::memory_order_relaxed);
+
+    std::sort(stats.keys.begin(), stats.keys.end(), [](const LookupStats &a, const LookupStats &b)
+    {
+        return a.lookups != b.lookups ? a.lookups > b.lookups : a.name < b.name;
+    });
+
+    return stats;
+}
+
+void StatsCollector::clear()
+{
+    for (TypeCounters &counters : this->types)
+    {
+        counters.lookups = 0;
+        counters.misses = 0;
+        counters.failures = 0;
+    }
+
+    // The names keep their slots, so a lookup on another thread never sees a freed name.
+    for (KeySlot &slot : this->keys)
+    {
+        slot.counters.lookups = 0;
+        slot.counters.misses = 0;
+        slot.counters.failures = 0;
+    }
+
+    this->untracked_lookups = 0;
+
+    std::lock_guard<std::mutex> lock(this->load_mutex);
+
+    this->loads = 0;
+    this->failed_loads = 0;
+    this->last_load = LoadStats();
+}
+
+std::string ConfigStats::to_text() const
+{
+    std::ostringstream text;
+
+    if (!this->enabled) return "Statistics are switched off.\n";
+
+    char line[160];
+    const LoadStats &load = this->last_load;
+
+    text << "Loads: " << this->loads << ", failed: " << this->failed_loads << "\n";
+    text << "Last load: version " << load.version << ", " << load.files << " files, " << load.bytes << " Bytes, "
+         << load.parameters << " parameters\n";
+
+    std::snprintf(line, sizeof(line), "  read %.3f ms, tokenize %.3f ms, index %.3f ms, total %.3f ms\n",
+                  load.read_ms, load.tokenize_ms, load.index_ms, load.total_ms);
+    text << line;
+
+    std::snprintf(line, sizeof(line), "\n  %-32s %12s %12s %12s\n", "type", "lookups", "misses", "failures");
+    text << line;
+
+    for (const LookupStats &type : this->types) text_line(text, type);
+
+    std::snprintf(line, sizeof(line), "\n  %-32s %12s %12s %12s\n", "parameter", "lookups", "misses", "failures");
+    text << line;
+
+    for (const LookupStats &key : this->keys) text_line(text, key);
+
+    if (this->untracked_lookups > 0) text << "  Lookups of untracked parameters: " << this->untracked_lookups << "\n";
+
+    return text.str();
+}
+
+std::string ConfigStats::to_json() const
+{
+    std::ostringstream json;
+    const LoadStats &load = this->last_load;
+
+    json << "{\n  \"enabled\": " << (this->enabled ? "true" : "false") << ",\n  \"loads\": " << this->loads
+         << ",\n  \"failed_loads\": " << this->failed_loads << ",\n  \"last_load\": {\"version\": " << load.version
+         << ", \"files\": " << load.files << ", \"bytes\": " << load.bytes << ", \"parameters\": " << load.parameters
+         << ", \"read_ms\": " << load.read_ms << ", \"tokenize_ms\": " << load.tokenize_ms << ", \"index_ms\": "
+         << load.index_ms << ", \"total_ms\": " << load.total_ms << "},\n  \"types\": [";
+
+    for (std::size_t i = 0; i < this->types.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    ";
+        json_entry(json, "type", this->types[i]);
+    }
+
+    json << "\n  ],\n  \"keys\": [";
+
+    for (std::size_t i = 0; i < this->keys.size(); i++)
+    {
+        json << (i ? "," : "") << "\n    ";
+        json_entry(json, "name", this->keys[i]);
+    }
+
+    json << "\n  ],\n  \"untracked_lookups\": " << this->untracked_lookups << "\n}\n";
+
+    return json.str();
+}
+
+}
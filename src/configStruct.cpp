@@ -0,0 +1,40 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configStruct.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Support of the structs which SPFR_generate writes from a configuration template.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "configStruct.hpp"
+#include "configTokenizer.hpp"
+
+
+namespace SPFR
+{
+
+bool ConfigTokens::open(const std::string &file_name, std::string &error)
+{
+    if (!this->file.open(file_name, error)) return false;
+
+    this->assign(std::string_view(this->file.data(), this->file.size()));
+
+    return true;
+}
+
+void ConfigTokens::assign(std::string_view text)
+{
+    this->tokens.clear();
+    this->spill.clear();
+
+    // The text is read-only, so tokens with spaces inside are copied without them.
+    tokenize_config(text.data(), text.size(), this->tokens, this->spill);
+}
+
+}
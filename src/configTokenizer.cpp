@@ -0,0 +1,371 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    configTokenizer.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Splits the text of a configuration file into names and values.
+ *
+ * Comments, delimiters and spaces are handled in the same pass, which replaces the former remove_comments and split
+ * steps of the load.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "configTokenizer.hpp"
+#include "valueConversion.hpp"
+
+
+namespace SPFR
+{
+namespace
+{
+
+/**
+ *  Scans the text and hands every token with spaces inside to "compact", which returns the token without them. The
+ *  scan itself never writes to the text.
+ */
+template <typename Compact>
+void tokenize(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens, Compact compact)
+{
+    const char *end = text + size;
+
+    // First and behind the last non-space character of the current token, and the number of non-space characters.
+    const char *token = nullptr;
+    const char *last = nullptr;
+    std::size_t length = 0;
+
+    // A part of a line which only has spaces still counts as an (empty) token.
+    const char *part = nullptr;
+    bool comment = false;
+
+    auto finish_token = [&]()
+    {
+        if (token != nullptr)
+        {
+            std::size_t span = static_cast<std::size_t>(last - token);
+
+            if (span == length) tokens.emplace_back(token, span);
+            else tokens.push_back(compact(token, span, length));
+        }
+        else if (part != nullptr)
+        {
+            tokens.emplace_back(part, 0);
+        }
+
+        token = nullptr;
+        part = nullptr;
+        length = 0;
+    };
+
+    for (const char *read = text; read != end; read++)
+    {
+        char c = *read;
+
+        if (c == '\n')
+        {
+            finish_token();
+            comment = false;
+        }
+        else if (comment)
+        {
+            continue;
+        }
+        else if (c == '#')
+        {
+            finish_token();
+            comment = true;
+        }
+        else if (c == ':')
+        {
+            finish_token();
+        }
+        else if (c == ' ')
+        {
+            if (part == nullptr) part = read;
+        }
+        else
+        {
+            if (part == nullptr) part = read;
+            if (token == nullptr) token = read;
+
+            last = read + 1;
+            length++;
+        }
+    }
+
+    finish_token();
+}
+
+/**
+ *  Cuts the text behind line ends into chunks and hands every chunk to "tokenize_chunk" on its own thread. Tokens never
+ *  cross a line end, so the tokens of the chunks in their order are the tokens of the whole text.
+ */
+template <typename TokenizeChunk>
+void tokenize_chunks(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                     unsigned thread_count, TokenizeChunk tokenize_chunk)
+{
+    // Below this size a chunk costs more for its thread than it saves.
+    const std::size_t min_chunk_size = 1 << 20;
+    std::size_t chunk_count = std::max<std::size_t>(1, std::min<std::size_t>(thread_count, size / min_chunk_size));
+
+    if (chunk_count == 1)
+    {
+        tokenize_chunk(0, text, size, tokens);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(chunk_count + 1, size);
+    bounds[0] = 0;
+
+    for (std::size_t i = 1; i < chunk_count; i++)
+    {
+        std::size_t from = std::max(i * (size / chunk_count), bounds[i - 1]);
+        const void *line_end = std::memchr(text + from, '\n', size - from);
+
+        bounds[i] = line_end ? static_cast<const char *>(line_end) - text + 1 : size;
+    }
+
+    // The first chunk goes directly into the result, the others are appended in their order.
+    std::vector<std::pmr::vector<std::string_view>> chunk_tokens(chunk_count);
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 1; i < chunk_count; i++)
+    {
+        threads.emplace_back(tokenize_chunk, i, text + bounds[i], bounds[i + 1] - bounds[i], std::ref(chunk_tokens[i]));
+    }
+
+    tokenize_chunk(0, text, bounds[1], tokens);
+
+    std::size_t token_count = tokens.size();
+
+    for (std::size_t i = 1; i < chunk_count; i++)
+    {
+        threads[i - 1].join();
+        token_count += chunk_tokens[i].size();
+    }
+
+    tokens.reserve(token_count);
+
+    for (std::size_t i = 1; i < chunk_count; i++)
+    {
+        tokens.insert(tokens.end(), chunk_tokens[i].begin(), chunk_tokens[i].end());
+    }
+}
+
+// Copies a token with spaces inside without them into the spill storage.
+auto spilling_compact(std::pmr::deque<std::pmr::string> &spill)
+{
+    return [&spill](const char *token, std::size_t span, std::size_t length)
+    {
+        // Arrays keep their spaces, because the array parsing skips them anyway. This keeps the big tables of a file
+        // out of the spill storage.
+        if (token[0] == '(' || token[0] == '[' || token[0] == '{') return std::string_view(token, span);
+
+        std::pmr::string &cleaned = spill.emplace_back();
+        cleaned.reserve(length);
+
+        for (std::size_t i = 0; i < span; i++)
+        {
+            if (token[i] != ' ') cleaned += token[i];
+        }
+
+        return std::string_view(cleaned);
+    };
+}
+
+}
+
+void tokenize_config(char *buffer, std::size_t size, std::pmr::vector<std::string_view> &tokens)
+{
+    // Usually there is one name and one value on every line.
+    tokens.reserve(tokens.size() + size / 16);
+
+    // Remove the spaces inside of the token in place. The token only gets shorter, so it stays in its own bytes.
+    tokenize(buffer, size, tokens, [buffer](const char *token, std::size_t span, std::size_t length)
+    {
+        char *begin = buffer + (token - buffer);
+        char *write = begin;
+
+        for (std::size_t i = 0; i < span; i++)
+        {
+            if (begin[i] != ' ') *write++ = begin[i];
+        }
+
+        return std::string_view(begin, length);
+    });
+}
+
+void tokenize_config(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                     std::pmr::deque<std::pmr::string> &spill)
+{
+    tokens.reserve(tokens.size() + size / 16);
+
+    tokenize(text, size, tokens, spilling_compact(spill));
+}
+
+void tokenize_config_lazy(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                          std::pmr::deque<std::pmr::string> &spill)
+{
+    const char *end = text + size;
+
+    auto find = [](const char *from, const char *to, char c)
+    {
+        return static_cast<const char *>(std::memchr(from, c, static_cast<std::size_t>(to - from)));
+    };
+
+    tokens.reserve(tokens.size() + size / 16);
+
+    for (const char *line = text; line < end;)
+    {
+        const char *line_end = find(line, end, '\n');
+
+        if (line_end == nullptr) line_end = end;
+
+        // Only the separators of the line are searched. The bytes of the name and the value aren't looked at.
+        const char *comment = find(line, line_end, '#');
+        const char *content_end = comment ? comment : line_end;
+        const char *colon = find(line, content_end, ':');
+
+        if (colon != nullptr && colon + 1 < content_end && find(colon + 1, content_end, ':') == nullptr)
+        {
+            const char *name = line;
+            const char *name_end = colon;
+
+            while (name < name_end && *name == ' ') name++;
+            while (name_end > name && name_end[-1] == ' ') name_end--;
+
+            if (name < name_end && find(name, name_end, ' ') == nullptr)
+            {
+                const char *value = colon + 1;
+                const char *value_end = content_end;
+
+                while (value < value_end && *value == ' ') value++;
+                while (value_end > value && value_end[-1] == ' ') value_end--;
+
+                // A line of one name and one value. The value keeps the spaces inside until it is read.
+                tokens.emplace_back(name, static_cast<std::size_t>(name_end - name));
+                tokens.emplace_back(value, static_cast<std::size_t>(value_end - value));
+
+                line = line_end + 1;
+                continue;
+            }
+        }
+
+        // Every other line, e.g. an empty one, a comment or one with more parts, gets the tokens of the full rules.
+        tokenize(line, static_cast<std::size_t>(line_end - line), tokens, spilling_compact(spill));
+
+        line = line_end + 1;
+    }
+}
+
+void tokenize_config(char *buffer, std::size_t size, std::pmr::vector<std::string_view> &tokens, unsigned thread_count)
+{
+    // Every chunk is compacted in its own bytes, so the threads never write to the same memory.
+    tokenize_chunks(buffer, size, tokens, thread_count,
+                    [buffer](std::size_t, const char *chunk, std::size_t chunk_size,
+                             std::pmr::vector<std::string_view> &chunk_tokens)
+    {
+        tokenize_config(buffer + (chunk - buffer), chunk_size, chunk_tokens);
+    });
+}
+
+void tokenize_config(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                     std::pmr::vector<std::pmr::deque<std::pmr::string>> &spills, unsigned thread_count)
+{
+    // One spill storage per chunk. The vector isn't resized while the threads run, so the storages stay in place.
+    spills.resize(std::max(1u, thread_count));
+
+    tokenize_chunks(text, size, tokens, thread_count,
+                    [&spills](std::size_t chunk_number, const char *chunk, std::size_t chunk_size,
+                              std::pmr::vector<std::string_view> &chunk_tokens)
+    {
+        tokenize_config(chunk, chunk_size, chunk_tokens, spills[chunk_number]);
+    });
+}
+
+void tokenize_config_lazy(const char *text, std::size_t size, std::pmr::vector<std::string_view> &tokens,
+                          std::pmr::vector<std::pmr::deque<std::pmr::string>> &spills, unsigned thread_count)
+{
+    // One spill storage per chunk, as for the full tokens.
+    spills.resize(std::max(1u, thread_count));
+
+    tokenize_chunks(text, size, tokens, thread_count,
+                    [&spills](std::size_t chunk_number, const char *chunk, std::size_t chunk_size,
+                              std::pmr::vector<std::string_view> &chunk_tokens)
+    {
+        tokenize_config_lazy(chunk, chunk_size, chunk_tokens, spills[chunk_number]);
+    });
+}
+
+void find_includes(const std::string &file_name, const std::pmr::vector<std::string_view> &tokens,
+                   std::vector<std::string> &includes)
+{
+    std::size_t slash = file_name.find_last_of('/');
+
+    for (std::size_t i = 0; i + 1 < tokens.size(); i = i + 2)
+    {
+        if (tokens[i] != include_directive) continue;
+
+        std::string include;
+
+        // A lazily split value still has its spaces.
+        parse_value(tokens[i + 1], include);
+
+        if (!include.empty() && include[0] != '/' && slash != std::string::npos)
+        {
+            include = file_name.substr(0, slash + 1) + include;
+        }
+
+        includes.push_back(std::move(include));
+    }
+}
+
+namespace
+{
+bool read_includes(const std::string &file_name, int depth, const FileReader &read_file,
+                   const std::function<void(const std::string &file_name)> &add_file, std::string &error)
+{
+    // A file which includes itself would be included forever. Other spellings of the same path end at the depth.
+    if (depth > max_include_depth)
+    {
+        error = "The includes of " + file_name + " are nested deeper than " + std::to_string(max_include_depth) +
+                " files, probably in a loop.";
+        return false;
+    }
+
+    std::vector<std::string> includes;
+
+    if (!read_file(file_name, includes)) return false;
+
+    for (const std::string &include : includes)
+    {
+        if (include == file_name)
+        {
+            error = "The configuration file " + file_name + " includes itself.";
+            return false;
+        }
+
+        if (!read_includes(include, depth + 1, read_file, add_file, error)) return false;
+    }
+
+    add_file(file_name);
+
+    return true;
+}
+}
+
+bool read_includes(const std::string &file_name, const FileReader &read_file,
+                   const std::function<void(const std::string &file_name)> &add_file, std::string &error)
+{
+    return read_includes(file_name, 0, read_file, add_file, error);
+}
+
+}
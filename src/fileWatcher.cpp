@@ -0,0 +1,197 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    fileWatcher.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Watches a file for changes with inotify.
+ *
+ * The thread sleeps in poll() on the inotify descriptor and on a pipe, which wakes it up for stopping. All files
+ * of one directory share the watch of the directory.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "fileWatcher.hpp"
+
+
+namespace SPFR
+{
+
+FileWatcher::~FileWatcher()
+{
+    this->stop();
+}
+
+bool FileWatcher::start(const std::string &file_name, std::function<void()> changed, std::string &error)
+{
+    return this->start(std::vector<std::string>{file_name}, std::move(changed), error);
+}
+
+bool FileWatcher::start(const std::vector<std::string> &file_names, std::function<void()> changed,
+                        std::string &error)
+{
+    this->stop();
+
+    this->changed = std::move(changed);
+
+    this->inotify_descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (this->inotify_descriptor < 0 || pipe2(this->stop_pipe, O_CLOEXEC) != 0)
+    {
+        error = std::strerror(errno);
+        this->stop();
+        return false;
+    }
+
+    if (!this->watch(file_names, error))
+    {
+        this->stop();
+        return false;
+    }
+
+    this->thread = std::thread(&FileWatcher::run, this);
+
+    return true;
+}
+
+bool FileWatcher::watch(const std::vector<std::string> &file_names, std::string &error)
+{
+    std::vector<WatchedFile> watched_files;
+
+    for (const std::string &file_name : file_names)
+    {
+        std::size_t slash = file_name.find_last_of('/');
+        std::string directory = (slash == std::string::npos) ? "." : (slash == 0 ? "/" : file_name.substr(0, slash));
+
+        // Written and closed, or moved in by a rename. A newly created file is only complete after it is closed.
+        // A directory which is already watched returns its existing watch.
+        int directory_watch = inotify_add_watch(this->inotify_descriptor, directory.c_str(),
+                                                IN_CLOSE_WRITE | IN_MOVED_TO);
+
+        if (directory_watch < 0)
+        {
+            error = std::strerror(errno);
+
+            // The watches which were added for the new files are removed again, the old ones stay.
+            this->remove_unused(watched_files, this->files);
+            return false;
+        }
+
+        watched_files.push_back(WatchedFile{directory_watch,
+                                            (slash == std::string::npos) ? file_name : file_name.substr(slash + 1)});
+    }
+
+    std::lock_guard<std::mutex> lock(this->files_mutex);
+
+    this->files.swap(watched_files);
+
+    // A directory without a watched file left would still wake up the thread for every change in it.
+    this->remove_unused(watched_files, this->files);
+
+    return true;
+}
+
+void FileWatcher::remove_unused(const std::vector<WatchedFile> &old_files, const std::vector<WatchedFile> &new_files)
+{
+    std::vector<int> removed;
+
+    for (const WatchedFile &old_file : old_files)
+    {
+        int watch = old_file.directory_watch;
+        auto same_watch = [watch](const WatchedFile &file) { return file.directory_watch == watch; };
+
+        if (std::none_of(new_files.begin(), new_files.end(), same_watch) &&
+            std::find(removed.begin(), removed.end(), watch) == removed.end())
+        {
+            inotify_rm_watch(this->inotify_descriptor, watch);
+            removed.push_back(watch);
+        }
+    }
+}
+
+void FileWatcher::stop()
+{
+    if (this->thread.joinable())
+    {
+        char wake_up = 0;
+        ssize_t written = write(this->stop_pipe[1], &wake_up, 1);
+        (void) written;
+
+        this->thread.join();
+    }
+
+    for (int *descriptor : {&this->inotify_descriptor, &this->stop_pipe[0], &this->stop_pipe[1]})
+    {
+        if (*descriptor >= 0) close(*descriptor);
+
+        *descriptor = -1;
+    }
+
+    this->files.clear();
+}
+
+bool FileWatcher::running() const
+{
+    return this->thread.joinable();
+}
+
+void FileWatcher::run()
+{
+    alignas(struct inotify_event) char events[4096];
+
+    for (;;)
+    {
+        struct pollfd descriptors[2] = {{this->inotify_descriptor, POLLIN, 0}, {this->stop_pipe[0], POLLIN, 0}};
+
+        if (poll(descriptors, 2, -1) < 0)
+        {
+            if (errno == EINTR) continue;
+
+            return;
+        }
+
+        if (descriptors[1].revents != 0) return;
+
+        bool file_changed = false;
+        ssize_t length;
+        std::unique_lock<std::mutex> lock(this->files_mutex);
+
+        while ((length = read(this->inotify_descriptor, events, sizeof(events))) > 0)
+        {
+            for (char *p = events; p < events + length; )
+            {
+                const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(p);
+
+                for (const WatchedFile &file : this->files)
+                {
+                    if (event->len > 0 && file.directory_watch == event->wd && file.base_name == event->name)
+                    {
+                        file_changed = true;
+                    }
+                }
+
+                p += sizeof(struct inotify_event) + event->len;
+            }
+        }
+
+        // The callback may replace the watched files.
+        lock.unlock();
+
+        // Several events of one save are handled with one call.
+        if (file_changed) this->changed();
+    }
+}
+
+}
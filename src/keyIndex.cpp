@@ -0,0 +1,102 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    keyIndex.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Hash index over the parameter names of a loaded configuration file.
+ *
+ * Linear probing over a power of two table, which is kept at most half full.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "keyIndex.hpp"
+
+
+namespace SPFR
+{
+
+void KeyIndex::clear()
+{
+    this->slots.clear();
+    this->mask = 0;
+    this->count = 0;
+}
+
+void KeyIndex::reserve(std::size_t count)
+{
+    std::size_t capacity = 16;
+
+    while (capacity < 2 * count) capacity *= 2;
+
+    if (capacity <= this->slots.size()) return;
+
+    std::pmr::vector<Slot> old_slots(capacity, Slot{0, std::string_view(), npos}, this->slots.get_allocator());
+    old_slots.swap(this->slots);
+
+    this->mask = capacity - 1;
+    this->count = 0;
+
+    // Re-insert the old entries in the bigger table. The order of the old table doesn't matter here, because every
+    // name is stored only once.
+    for (const Slot &slot : old_slots)
+    {
+        if (slot.position != npos) this->insert(slot.key, slot.key_hash, slot.position);
+    }
+}
+
+void KeyIndex::grow()
+{
+    this->reserve(this->slots.empty() ? 8 : this->slots.size());
+}
+
+bool KeyIndex::insert(std::string_view key, std::uint32_t position)
+{
+    return this->insert(key, hash(key), position);
+}
+
+bool KeyIndex::insert(std::string_view key, std::uint64_t key_hash, std::uint32_t position)
+{
+    if (2 * (this->count + 1) > this->slots.size()) this->grow();
+
+    for (std::size_t i = key_hash & this->mask;; i = (i + 1) & this->mask)
+    {
+        Slot &slot = this->slots[i];
+
+        if (slot.position == npos)
+        {
+            slot = Slot{key_hash, key, position};
+            this->count++;
+
+            return true;
+        }
+
+        // The first entry of a name wins, later duplicates are ignored.
+        if (slot.key_hash == key_hash && slot.key == key) return false;
+    }
+}
+
+std::uint32_t KeyIndex::find(std::string_view key) const
+{
+    return this->find(key, hash(key));
+}
+
+std::uint32_t KeyIndex::find(std::string_view key, std::uint64_t key_hash) const
+{
+    if (this->count == 0) return npos;
+
+    for (std::size_t i = key_hash & this->mask;; i = (i + 1) & this->mask)
+    {
+        const Slot &slot = this->slots[i];
+
+        if (slot.position == npos) return npos;
+
+        if (slot.key_hash == key_hash && slot.key == key) return slot.position;
+    }
+}
+
+}
@@ -0,0 +1,100 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    mappedFile.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Read-only memory mapping of a file.
+ *
+ * The pages of the mapping belong to the page cache, so a big file doesn't increase the heap of the process.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mappedFile.hpp"
+
+
+namespace SPFR
+{
+
+MappedFile::~MappedFile()
+{
+    this->close();
+}
+
+bool MappedFile::open(const std::string &file_name, std::string &error, Access access)
+{
+    this->close();
+
+    int descriptor = ::open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (descriptor < 0)
+    {
+        error = std::strerror(errno);
+        return false;
+    }
+
+    struct stat status;
+
+    if (::fstat(descriptor, &status) != 0)
+    {
+        error = std::strerror(errno);
+        ::close(descriptor);
+        return false;
+    }
+
+    if (!S_ISREG(status.st_mode))
+    {
+        error = S_ISDIR(status.st_mode) ? "The path is a directory." : "The path is not a regular file.";
+        ::close(descriptor);
+        return false;
+    }
+
+    // An empty file can't be mapped, but it is still a valid (empty) configuration.
+    if (status.st_size > 0)
+    {
+        void *address = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE,
+                               descriptor, 0);
+
+        if (address == MAP_FAILED)
+        {
+            error = std::strerror(errno);
+            ::close(descriptor);
+            return false;
+        }
+
+        ::madvise(address, static_cast<std::size_t>(status.st_size),
+                  access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+
+        this->mapping = static_cast<const char *>(address);
+        this->length = static_cast<std::size_t>(status.st_size);
+    }
+
+    // The mapping stays valid after closing the file descriptor.
+    ::close(descriptor);
+
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (this->mapping != nullptr)
+    {
+        ::munmap(const_cast<char *>(this->mapping), this->length);
+    }
+
+    this->mapping = nullptr;
+    this->length = 0;
+}
+
+}
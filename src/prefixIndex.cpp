@@ -0,0 +1,114 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    prefixIndex.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Sorted index over the parameter names of a loaded configuration.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "prefixIndex.hpp"
+
+
+namespace SPFR
+{
+namespace
+{
+
+// Eight bytes of the name from the offset on. Numbers of this form compare like the bytes, a shorter name is padded.
+std::uint64_t name_bytes(std::string_view name, std::size_t offset)
+{
+    std::uint64_t bytes = 0;
+
+    for (std::size_t i = offset; i < offset + 8; i++)
+    {
+        bytes = (bytes << 8) | (i < name.size() ? static_cast<unsigned char>(name[i]) : 0u);
+    }
+
+    return bytes;
+}
+
+/**
+ *  Sorts the entries by eight bytes of their names at a time. Only entries with the same bytes so far are sorted by
+ *  their next bytes, so the comparisons don't read the names, which are spread over the whole text. Names in
+ *  sections share long prefixes, which makes a plain comparison of the names about twice as slow.
+ */
+void sort_names(PrefixIndex::Entry *first, PrefixIndex::Entry *last, std::size_t offset)
+{
+    using Entry = PrefixIndex::Entry;
+
+    for (Entry *entry = first; entry != last; entry++) entry->bytes = name_bytes(entry->name, offset);
+
+    std::sort(first, last, [](const Entry &a, const Entry &b) { return a.bytes < b.bytes; });
+
+    for (Entry *run = first; run != last;)
+    {
+        Entry *run_end = run + 1;
+        bool longer = run->name.size() > offset + 8;
+
+        while (run_end != last && run_end->bytes == run->bytes)
+        {
+            longer = longer || run_end->name.size() > offset + 8;
+            run_end++;
+        }
+
+        if (run_end - run > 1 && longer) sort_names(run, run_end, offset + 8);
+
+        run = run_end;
+    }
+}
+
+}
+
+void PrefixIndex::sort()
+{
+    Entry *begin = this->entries.data();
+    Entry *end = begin + this->entries.size();
+
+    sort_names(begin, end, 0);
+
+    // The entries of a name are neighbours now. Only the first one in the configuration is found by a lookup.
+    Entry *write = begin;
+
+    for (Entry *read = begin; read != end;)
+    {
+        Entry *first = read;
+
+        for (read++; read != end && read->name == first->name; read++)
+        {
+            if (read->entry < first->entry) first = read;
+        }
+
+        *write++ = *first;
+    }
+
+    this->entries.resize(static_cast<std::size_t>(write - begin));
+}
+
+PrefixIndex::Range PrefixIndex::find(std::string_view prefix) const
+{
+    const Entry *begin = this->entries.data();
+    const Entry *end = begin + this->entries.size();
+
+    // The names with the prefix start at the first name which isn't smaller than the prefix itself.
+    const Entry *first = std::lower_bound(begin, end, prefix, [](const Entry &entry, std::string_view name)
+    {
+        return entry.name < name;
+    });
+
+    const Entry *last = std::partition_point(first, end, [prefix](const Entry &entry)
+    {
+        return entry.name.substr(0, prefix.size()) == prefix;
+    });
+
+    return Range{first, last};
+}
+
+}
@@ -15,761 +15,1706 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include <cstring>
-#include <iostream>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <thread>
+#include <type_traits>
 #include <experimental/filesystem>
 
 #include "readConfig.hpp"
+#include "configBlocks.hpp"
+#include "configTokenizer.hpp"
+#include "valueConversion.hpp"
+#include "fileWatcher.hpp"
 
 
 namespace SPFR
 {
+namespace
+{
 
-ReadConfig::ReadConfig(std::string config_file_name)
+// Prints an array lazily, so the text is only built when the message is written.
+template <typename T>
+struct ArrayText
 {
-    this->_config_file_name = config_file_name;
-    this->data_size_tested = false;
-    this->data_size_ok = false;
-    this->Init();
-}
+    const T *values;
+    int size;
+};
 
-ReadConfig::~ReadConfig()
+template <typename T>
+std::ostream &operator<<(std::ostream &stream, const ArrayText<T> &array)
 {
+    stream << "[";
+
+    for (int i = 0; i < array.size; i++)
+    {
+        stream << array.values[i];
+
+        if (i < array.size - 1) stream << ", ";
+    }
 
+    return stream << "]";
 }
 
-void ReadConfig::Init()
+template <typename T>
+ArrayText<T> array_text(const T *values, int size)
 {
-    std::cout << "File name of the configuration file: " << this->_config_file_name.c_str() << std::endl;
+    return ArrayText<T>{values, size};
+}
 
-    // Check the size of the configuration file and if it is too big or a directory end the program.
-    std::experimental::filesystem::path p = this->_config_file_name.c_str();
+// Prints the missing and invalid parameters of a resolve() call lazily.
+struct SummaryText
+{
+    const BindSummary &summary;
+};
 
-    try {
-        std::experimental::filesystem::file_size(p);
-    } catch(std::experimental::filesystem::filesystem_error& e) {
-        std::cout << "Error while reading the configuration file. " << e.what() << '\n';
-        return;
-    } 
+std::ostream &operator<<(std::ostream &stream, const SummaryText &text)
+{
+    for (std::size_t i = 0; i < text.summary.missing.size(); i++)
+    {
+        stream << (i == 0 ? " Missing: " : ", ") << text.summary.missing[i];
+    }
 
-    std::cout << "Size of the configuration file: " << std::experimental::filesystem::file_size(p) << " Bytes" << '\n';
+    if (!text.summary.missing.empty()) stream << ".";
 
-    if(std::experimental::filesystem::file_size(p) > 1048576)
+    for (std::size_t i = 0; i < text.summary.errors.size(); i++)
     {
-        std::cout << "Size exceeds the limit of 1 MB. Stop reading the file." << '\n';
-        return;
+        const BindError &error = text.summary.errors[i];
+
+        stream << (i == 0 ? " Invalid: " : ", ") << error.parameter << " (" << error.message << ")";
     }
 
-    // Read the text file.
-    std::ifstream text_config(this->_config_file_name);
+    if (!text.summary.errors.empty()) stream << ".";
 
-    text_config.seekg(0, std::ios::end);
+    return stream;
+}
 
-    size_t size = text_config.tellg();
+using Clock = std::chrono::steady_clock;
 
-    std::string buffer(size, ' ');
+double milliseconds_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
 
-    text_config.seekg(0);
+// Type of the statistics for the stored type of a variable.
+ParameterType parameter_type(const std::pmr::string *) { return ParameterType::String; }
+ParameterType parameter_type(const char *) { return ParameterType::Char; }
+ParameterType parameter_type(const int *) { return ParameterType::Int; }
+ParameterType parameter_type(const float *) { return ParameterType::Float; }
+ParameterType parameter_type(const bool *) { return ParameterType::Bool; }
+ParameterType parameter_type(const std::pmr::vector<int> *) { return ParameterType::IntArray; }
+ParameterType parameter_type(const std::pmr::vector<float> *) { return ParameterType::FloatArray; }
+ParameterType parameter_type(const std::pmr::vector<char> *) { return ParameterType::CharArray; }
+ParameterType parameter_type(const std::pmr::vector<std::pmr::string> *) { return ParameterType::StringArray; }
+
+// Why a found value can't be converted to the type of the variable.
+const char *invalid_reason(const int *) { return "Cannot read the value as a number."; }
+const char *invalid_reason(const float *) { return "Cannot read the value as a number."; }
+const char *invalid_reason(const char *) { return "Only one character expected, but found more than one."; }
+const char *invalid_reason(const std::string *) { return "Cannot read the value."; }
+
+const char *invalid_reason(const bool *)
+{
+    return "Cannot read the value! Allowed values are: 0, 1, true, false, TRUE and FALSE.";
+}
 
-    text_config.read(&buffer[0], size); 
+// Why a field of an array can't be converted.
+const char *invalid_field_reason(const int *) { return " is not a valid number."; }
+const char *invalid_field_reason(const float *) { return " is not a valid number."; }
+const char *invalid_field_reason(const char *) { return " has none or more than one character."; }
+const char *invalid_field_reason(const std::string *) { return " is not valid."; }
 
-    // Remove all comments from string buffer.
-    std::string buffer_new = this->remove_comments(buffer);
+}
 
-    // Seperate the variables from the string.
-    this->raw_config = split(buffer_new, ":", " ");
+ReadConfig::ReadConfig(std::string config_file_name) : ReadConfig(config_file_name, ReadOptions())
+{
 
-    if (this->raw_config.size()%2 != 0)
-    {
-        std::cout << std::endl;
-        std::cout << "######### ERROR #########" << std::endl;
-        std::cout << "The configuration file has one or more wrong parameter." << std::endl;
-        std::cout << "Limitations: There are no spaces in the path string allowed. " <<
-                     "Comments are also not allowed." << std::endl;
+}
+
+ReadConfig::ReadConfig(std::string config_file_name, ReadOptions options)
+    : ReadConfig(std::vector<std::string>{config_file_name}, options)
+{
 
-        std::cout << std::endl;
-        std::cout << "Here an example of an allowed format:" << std::endl;
-        std::cout << std::endl;
-        std::cout << "path: /home/USERNAME/workspace/blubb" << std::endl;
-        std::cout << "number_int: 12" << std::endl;
-        std::cout << "number_float: 4234.234234" << std::endl;
-        std::cout << "number_bool_1: 1" << std::endl;
-        std::cout << "number_bool_2: false" << std::endl;
-        std::cout << "number_array: [2,3,4.5]" << std::endl;
-        std::cout << "list: {Hello, World, !}" << std::endl;
-        std::cout << std::endl;
-    }
-    else
-    {
-        std::cout << "Success in reading the configuration file." << std::endl;
-    }
 }
 
-std::string ReadConfig::remove_comments(std::string &buffer)
+ReadConfig::ReadConfig(std::vector<std::string> config_file_names)
+    : ReadConfig(config_file_names, ReadOptions())
 {
-    int n = buffer.length(); 
-    std::string buffer_new; 
-  
-    // Flags to indicate that comments have started or not. 
-    bool comment = false;
-    bool new_line = true;
-    bool whole_line_is_comment = false;
-  
-    for (int i=0; i<n; i++) 
-    { 
-        // If single line comment flag is on, then check for end of it.
-        if (comment == true && buffer[i] == '\n') 
-        {
-            comment = false;
 
-            // If the comments are at the end of a line with values, keep the "new line".
-            if(!whole_line_is_comment)
-            {
-                buffer_new += '\n'; 
-            }
-        }   
-        // If this character is in a comment, ignore it.
-        else if (comment) 
-        {
-            continue; 
-        }
-        // Check for beginning of comments and set the approproate flags 
-        else if (buffer[i] == '#') 
-        {
-            comment = true; 
+}
 
-            if (new_line)
-            {
-                whole_line_is_comment = true;
-            }
-            else
-            {
-                whole_line_is_comment = false;
-            }
-        }
-        // If current character is a non-comment character, append it to res 
-        else
-        {  
-            buffer_new += buffer[i]; 
-        }
+ReadConfig::ReadConfig(std::vector<std::string> config_file_names, ReadOptions options)
+{
+    this->_config_file_names = config_file_names;
+    this->_options = options;
+    this->log.configure(options.log_mode, options.log_level, options.log_callback, options.log_capacity);
 
-        // Check for new lines.
-        if (buffer[i] == '\n')
-        {
-            new_line = true;
-        }
-        else
-        {
-            new_line = false;
-        }
-    } 
+    if (options.collect_stats) this->stats = std::make_unique<StatsCollector>();
 
-    return buffer_new; 
+    this->Init();
 }
 
-std::vector<std::string> ReadConfig::split(const std::string& s, std::string delimiter, std::string delete_chars)
+ReadConfig::~ReadConfig()
 {
-    std::vector<std::string> wordVector;
-    std::stringstream stringStream(s);
-    std::string line;
+    // Stop the reloads before the snapshots are freed.
+    this->watcher.stop();
+}
 
-    // Split the string according to the "limiter" string and after each new line.
-    while(std::getline(stringStream, line)) 
-    {
-        std::size_t prev = 0, pos;
-        while ((pos = line.find_first_of(delimiter, prev)) != std::string::npos)
-        {
-            if (pos > prev)
-            {
-                wordVector.push_back(line.substr(prev, pos-prev));
-            }
+std::vector<LogRecord> ReadConfig::get_log() const
+{
+    return this->log.records();
+}
 
-            prev = pos+1;
-        }
+std::uint64_t ReadConfig::get_log_dropped() const
+{
+    return this->log.dropped();
+}
+
+void ReadConfig::clear_log()
+{
+    this->log.clear();
+}
+
+ConfigStats ReadConfig::get_stats() const
+{
+    return this->stats ? this->stats->stats() : ConfigStats();
+}
+
+void ReadConfig::clear_stats()
+{
+    if (this->stats) this->stats->clear();
+}
+
+template <typename... Args>
+void ReadConfig::report(Severity severity, std::string_view value_name, const Args &... args) const
+{
+    // Nothing is formatted for a message which isn't written anyway.
+    if (!this->log.enabled(severity)) return;
 
-        if (prev < line.length())
+    std::ostringstream message;
+    (message << ... << args);
+
+    this->log.write(severity, value_name, message.str());
+}
+
+void ReadConfig::Init()
+{
+    this->next_version = 1;
+
+    std::vector<std::string> file_names;
+    this->snapshots.publish(this->load(file_names));
+
+    if (this->_options.hot_reload)
+    {
+        std::string error;
+
+        if (!this->watcher.start(file_names, [this]() { this->reload(); }, error))
         {
-            wordVector.push_back(line.substr(prev, std::string::npos));
+            this->report(Severity::Error, "", "Error while watching the configuration file. ", error);
         }
     }
+}
+
+bool ReadConfig::reload()
+{
+    // Reloads of the watcher and of the user are done one after the other. The readers don't wait for them.
+    std::lock_guard<std::mutex> lock(this->reload_mutex);
 
-    // Remove characters from the sub strings according to the "delete_chars".
-    // TODO: Spaces in path strings are NOT supported! I need to fix this.
-    for (int j = 0; j < wordVector.size(); j++)
+    std::vector<std::string> file_names;
+    std::unique_ptr<ConfigSnapshot> snapshot = this->load(file_names);
+
+    // The include directives could have changed, so the watcher follows the files of the last load. This is done
+    // even if the load failed, so a missing file is noticed as soon as it is created. A watcher which couldn't be
+    // started has no descriptor, its error was already reported by the constructor.
+    if (this->_options.hot_reload && this->watcher.running())
     {
-        for (int k = 0; k < delete_chars.size(); k++) 
-        {           
-            wordVector.at(j).erase(std::remove(wordVector.at(j).begin(), wordVector.at(j).end(), delete_chars[k]),
-            wordVector.at(j).end());
+        std::string error;
+
+        if (!this->watcher.watch(file_names, error))
+        {
+            this->report(Severity::Error, "", "Error while watching the configuration file. ", error);
         }
     }
 
-    return wordVector;
+    // Keep the current version if the new file can't be read, e.g. while it is deleted.
+    if (snapshot->version == 0) return false;
+
+    this->snapshots.publish(std::move(snapshot));
+
+    return true;
 }
 
-void ReadConfig::check_data_size()
+std::uint64_t ReadConfig::get_version() const
 {
-    this->data_size_tested = true;
+    SnapshotDomain::Guard snapshot(this->snapshots);
 
-    // If the config file is empty, this gives the user a hint.
-    if(this->raw_config.size() == 0)
-    {
-        std::cout << "Data invalid! Please read the previous output for further information." <<
-        " Using initial values..." << std::endl;
-    }
-    else
-    {
-        this->data_size_ok = true;
-    }
+    return snapshot->version;
 }
 
-void ReadConfig::get_parameter(std::string int_value_name, int &int_value)
+std::uint64_t ReadConfig::get_generation() const
 {
-    int result = -1;
+    SnapshotDomain::Guard snapshot(this->snapshots);
 
-    if(!this->data_size_tested) this->check_data_size();
+    return snapshot->image.generation();
+}
 
-    if (this->data_size_ok)
-    {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
-        {
-            result = this->raw_config.at(i).compare(int_value_name);
+std::shared_ptr<ConfigArena> ReadConfig::make_arena() const
+{
+    std::pmr::memory_resource *upstream = this->_options.memory_resource;
 
-            if (result == 0)
-            {
-                int_value = std::stoi(this->raw_config.at(i+1));
+    if (upstream == nullptr) upstream = std::pmr::get_default_resource();
 
-                std::cout << "Parameter for " << int_value_name.c_str() << " is: " << int_value << std::endl; 
+    // The arena itself comes from the same resource as its blocks.
+    return std::allocate_shared<ConfigArena>(std::pmr::polymorphic_allocator<ConfigArena>(upstream), upstream);
+}
 
-                return;
-            }
-        }
-    }
+std::unique_ptr<ConfigSnapshot> ReadConfig::load(std::vector<std::string> &file_names)
+{
+    Clock::time_point start = Clock::now();
+
+    this->load_stats = LoadStats();
 
-    if (result != 0)
+    std::unique_ptr<ConfigSnapshot> snapshot = this->read_files(file_names);
+
+    if (this->stats)
     {
-        std::cout << "Could not find the parameter for " << int_value_name.c_str() << ". Using instead the " <<
-        "initial value: " << int_value << std::endl; 
+        this->load_stats.version = snapshot->version;
+        this->load_stats.parameters = snapshot->image.is_open()     ? snapshot->image.size()
+                                      : !snapshot->compact.empty()  ? snapshot->compact.size()
+                                                                    : snapshot->raw_config.size() / 2;
+        this->load_stats.total_ms = milliseconds_since(start);
+        this->stats->count_load(this->load_stats, snapshot->version == 0);
     }
 
-    return;
+    return snapshot;
 }
 
-
-void ReadConfig::get_parameter(std::string char_value_name, char &char_value)
+std::unique_ptr<ConfigSnapshot> ReadConfig::read_files(std::vector<std::string> &file_names)
 {
-    int result = -1;
+    unsigned thread_count = this->_options.parse_threads;
 
-    if(!this->data_size_tested) this->check_data_size();
+    if (thread_count == 0) thread_count = std::max(1u, std::thread::hardware_concurrency());
 
-    if (this->data_size_ok)
+    if (this->_options.load_mode == LoadMode::Compiled || this->_options.load_mode == LoadMode::Shared)
     {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
+        std::unique_ptr<ConfigSnapshot> snapshot = std::make_unique<ConfigSnapshot>(this->make_arena());
+
+        file_names = this->_config_file_names;
+
+        if (file_names.size() != 1)
+        {
+            this->report(Severity::Error, "", "The compiled load mode reads exactly one image, but ",
+                         file_names.size(), " files were given.");
+            return snapshot;
+        }
+
+        this->report(Severity::Info, "", "File name of the configuration file: ", file_names[0]);
+
+        // A published image is a file of the shared memory, which the hot reload watches like any other file.
+        if (this->_options.load_mode == LoadMode::Shared)
         {
-            result = this->raw_config.at(i).compare(char_value_name);
+            std::string shared_path = ConfigImage::shared_path(file_names[0]);
 
-            if (result == 0)
+            if (shared_path.empty())
             {
-                if (this->raw_config.at(i+1).length() == 1)
-                {
-                    std::string str = this->raw_config.at(i+1);
-                    std::vector<char> cstr(str.c_str(), str.c_str() + str.size() + 1);
-                
-                    char_value = cstr[0];
-
-                    std::cout << "Parameter for " << char_value_name.c_str() << " is: " << char_value << std::endl; 
-
-                    return;
-                }
-                else
-                {
-                    std::cout << "Only one character expected for the parameter " << char_value_name.c_str() << 
-                    ", but found more than one. Using instead the initial value: " << char_value << std::endl; 
-        
-                    return;
-                }
+                this->report(Severity::Error, "", "The shared memory name ", file_names[0], " has to start with a ",
+                             "'/' and can't have another one.");
+                return snapshot;
             }
+
+            file_names[0] = shared_path;
+        }
+
+        std::uintmax_t file_size = 0;
+
+        try {
+            file_size = std::experimental::filesystem::file_size(file_names[0]);
+        } catch(std::experimental::filesystem::filesystem_error& e) {
+            this->report(Severity::Error, "", "Error while reading the configuration file. ", e.what());
+            return snapshot;
+        }
+
+        this->report(Severity::Info, "", "Size of the configuration file: ", file_size, " Bytes");
+
+        // The image is only mapped. Its header is checked, everything else is read on demand.
+        std::string error;
+        Clock::time_point start = Clock::now();
+
+        if (!snapshot->image.open(file_names[0], error))
+        {
+            this->report(Severity::Error, "", "Error while opening the compiled configuration file. ", error);
+            return snapshot;
+        }
+
+        this->load_stats.files = 1;
+        this->load_stats.bytes = file_size;
+        this->load_stats.read_ms = milliseconds_since(start);
+
+        snapshot->version = this->next_version++;
+        snapshot->typed_values.resize(snapshot->image.size());
+        snapshot->data_size_ok = snapshot->image.size() > 0;
+
+        this->report(Severity::Info, "", "Success in reading the compiled configuration file.");
+
+        if (snapshot->image.generation() > 0)
+        {
+            this->report(Severity::Info, "", "Generation of the published configuration: ",
+                         snapshot->image.generation());
+        }
+
+        if (!snapshot->data_size_ok)
+        {
+            this->report(Severity::Warning, "", "Data invalid! The compiled configuration has no parameters. ",
+                         "Using initial values...");
         }
+
+        if (this->_options.schema) this->check_schema(*snapshot);
+
+        return snapshot;
     }
 
-    if (result != 0)
+    // Every file comes after the files it includes, so the order is from the lowest to the highest priority.
+    LayerCache loaded;
+    std::vector<std::shared_ptr<ConfigLayer>> layers;
+
+    for (const std::string &file_name : this->_config_file_names)
     {
-        std::cout << "Could not find the parameter for " << char_value_name.c_str() << ". Using instead the " <<
-        "initial value: " << char_value << std::endl; 
+        if (!this->add_layers(file_name, thread_count, loaded, layers, file_names))
+        {
+            return std::make_unique<ConfigSnapshot>(this->make_arena());
+        }
     }
 
-    return;
-}
+    // A single file is used as it is. It isn't kept for the next load, because that only happens after it changed.
+    // The incremental reload needs its tokens for the next load.
+    bool single_file = layers.size() == 1 && layers[0]->includes.empty() && layers[0]->hashes.empty() &&
+                       !this->_options.incremental_reload && !this->_options.compact_storage;
 
+    // The snapshot of a single file lives exactly as long as its layer, so both share one arena.
+    std::unique_ptr<ConfigSnapshot> snapshot = std::make_unique<ConfigSnapshot>(single_file ? layers[0]->arena
+                                                                                            : this->make_arena());
 
-void ReadConfig::get_parameter(std::string float_value_name, float &float_value)
-{
-    int result = -1;
+    // The files were read, so this is a new version of the configuration, even if it is empty or invalid.
+    snapshot->version = this->next_version++;
+    snapshot->lazy_values = this->_options.lazy_values;
+    snapshot->schema = this->_options.schema;
+
+    bool format_ok = true;
 
-    if(!this->data_size_tested) this->check_data_size();
+    for (const std::shared_ptr<ConfigLayer> &layer : layers) format_ok = format_ok && layer->format_ok;
 
-    if (this->data_size_ok)
+    Clock::time_point index_start = Clock::now();
+
+    if (this->_options.compact_storage)
     {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
+        // The names and values are copied into the arena of the snapshot, the layers are freed after the load. Only
+        // the incremental reload keeps them for the next load.
+        if (!compact_layers(*snapshot, layers))
         {
-            result = this->raw_config.at(i).compare(float_value_name);
+            this->report(Severity::Error, "", "The configuration is too big for the compact storage, which holds ",
+                         "up to 4 GB of names and values.");
+        }
 
-            if (result == 0)
-            {
-                float_value = std::stof(this->raw_config.at(i+1));
+        snapshot->lazy_values = false;
+
+        if (this->_options.incremental_reload) this->layer_cache.swap(loaded);
+        else this->layer_cache.clear();
 
-                std::cout << "Parameter for " << float_value_name.c_str() << " is: " << float_value << std::endl; 
+        layers.clear();
+    }
+    else if (single_file)
+    {
+        // Both vectors use the same arena, so the tokens are moved and not copied.
+        snapshot->raw_config = std::move(layers[0]->raw_config);
 
-                return;
+        // Index the parameter names, so every lookup doesn't have to scan the whole configuration.
+        build_index(*snapshot, thread_count);
+
+        this->layer_cache.clear();
+    }
+    else
+    {
+        // Only the files which were parsed now are hashed, the others still have their hashes.
+        for (const std::shared_ptr<ConfigLayer> &layer : layers)
+        {
+            if (layer->hashes.size() != layer->raw_config.size() / 2)
+            {
+                hash_names(layer->raw_config, layer->hashes, thread_count);
             }
         }
+
+        merge_layers(*snapshot, layers);
+
+        this->layer_cache.swap(loaded);
     }
 
-    if (result != 0)
+    this->load_stats.index_ms = milliseconds_since(index_start);
+
+    snapshot->layers.assign(layers.begin(), layers.end());
+
+    // The values are converted on their first read.
+    snapshot->typed_values.resize(snapshot->compact.empty() ? snapshot->raw_config.size() / 2
+                                                            : snapshot->compact.size());
+
+    if (format_ok) this->report(Severity::Info, "", "Success in reading the configuration file.");
+
+    // If the config file is empty, this gives the user a hint.
+    snapshot->data_size_ok = !snapshot->raw_config.empty() || !snapshot->compact.empty();
+
+    if (!snapshot->data_size_ok)
     {
-        std::cout << "Could not find the parameter for " << float_value_name.c_str() << ". Using instead the " <<
-        "initial value: " << float_value << std::endl; 
+        this->report(Severity::Warning, "", "Data invalid! Please read the previous output for further ",
+                     "information. Using initial values...");
     }
 
-    return;
+    if (snapshot->schema) this->check_schema(*snapshot);
+
+    return snapshot;
 }
 
-void ReadConfig::get_parameter(std::string str_value_name, std::string &str_value)
+bool ReadConfig::add_layers(const std::string &file_name, unsigned thread_count, LayerCache &loaded,
+                            std::vector<std::shared_ptr<ConfigLayer>> &layers, std::vector<std::string> &file_names)
 {
-    int result = -1;
-
-    if(!this->data_size_tested) this->check_data_size();
+    std::string error;
 
-    if (this->data_size_ok)
+    auto read_file = [&](const std::string &name, std::vector<std::string> &includes)
     {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
-        {
-            result = this->raw_config.at(i).compare(str_value_name);
+        file_names.push_back(name);
 
-            if (result == 0)
-            {
-                str_value = this->raw_config.at(i+1);
+        std::shared_ptr<ConfigLayer> layer = this->read_layer(name, thread_count, loaded);
 
-                std::cout << "Parameter for " << str_value_name.c_str() << " is: " << str_value << std::endl; 
+        if (!layer) return false;
 
-                return;
-            }
-        }
-    }
+        includes = layer->includes;
+
+        return true;
+    };
 
-    if (result != 0)
+    // Every read layer is in the cache of the load.
+    auto add_file = [&](const std::string &name) { layers.push_back(loaded.at(name)); };
+
+    if (!read_includes(file_name, read_file, add_file, error))
     {
-        std::cout << "Could not find the parameter for " << str_value_name.c_str() << ". Using instead the " <<
-        "initial value: " << str_value << std::endl; 
+        if (!error.empty()) this->report(Severity::Error, "", "Error while reading the configuration file. ", error);
+
+        return false;
     }
 
-    return;
+    return true;
 }
 
-void ReadConfig::get_parameter(std::string bool_value_name, bool &bool_value)
+std::shared_ptr<ConfigLayer> ReadConfig::read_layer(const std::string &file_name, unsigned thread_count,
+                                                    LayerCache &loaded)
 {
-    int result = -1;
+    // A file which is included twice is only read once.
+    LayerCache::iterator known = loaded.find(file_name);
 
-    if(!this->data_size_tested) this->check_data_size();
+    if (known != loaded.end()) return known->second;
 
-    if (this->data_size_ok)
-    {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
-        {
-            result = this->raw_config.at(i).compare(bool_value_name);
+    this->report(Severity::Info, "", "File name of the configuration file: ", file_name);
 
-            if (result == 0)
-            {
-                if (this->raw_config.at(i+1).compare("1") || this->raw_config.at(i+1).compare("true") 
-                                                          || this->raw_config.at(i+1).compare("TRUE"))
-                {
-                    bool_value = true;
-                    
-                    std::cout << "Parameter for " << bool_value_name.c_str() << " is: true" << std::endl; 
-
-                    return;
-                }
-                else if (this->raw_config.at(i+1).compare("0") || this->raw_config.at(i+1).compare("false") 
-                                                               || this->raw_config.at(i+1).compare("FALSE"))
-                {
-                    bool_value = false;
-                    
-                    std::cout << "Parameter for " << bool_value_name.c_str() << " is: false" << std::endl; 
-
-                    return;
-                }
-                else
-                {
-                    result = -1;
-                    
-                    std::cout << "Cannot read the value! Allowed values are: 0, 1, true, false, TRUE and FALSE." << 
-                    std::endl; 
-                    
-                    return;
-                }
-            }
-        }
-    }
+    Clock::time_point start = Clock::now();
 
-    if (result != 0)
+    // Check the size of the configuration file and if it is too big or a directory end the program.
+    std::experimental::filesystem::path p = file_name.c_str();
+    std::uintmax_t file_size = 0;
+    std::experimental::filesystem::file_time_type write_time;
+
+    try {
+        file_size = std::experimental::filesystem::file_size(p);
+        write_time = std::experimental::filesystem::last_write_time(p);
+    } catch(std::experimental::filesystem::filesystem_error& e) {
+        this->report(Severity::Error, "", "Error while reading the configuration file. ", e.what());
+        return nullptr;
+    } 
+
+    // A file which wasn't changed since the last load keeps its tokens, only the merge is done again. The time stamps
+    // of files are coarse, so a file which was written shortly before it was read could have been written again
+    // with the same time stamp. Such a file is read again.
+    LayerCache::iterator cached = this->layer_cache.find(file_name);
+
+    if (cached != this->layer_cache.end() && cached->second->file_size == file_size &&
+        cached->second->write_time == write_time && write_time + std::chrono::seconds(1) < cached->second->read_time)
     {
-        std::cout << "Could not find the parameter for " << bool_value_name.c_str() << ". Using instead the " <<
-        "initial value: " << bool_value << std::endl; 
+        this->report(Severity::Info, "", "The configuration file is unchanged since the last load.");
+
+        this->load_stats.files++;
+        this->load_stats.read_ms += milliseconds_since(start);
+
+        loaded.insert(*cached);
+
+        return cached->second;
     }
 
-    return;
-}
+    this->report(Severity::Info, "", "Size of the configuration file: ", file_size, " Bytes");
+
+    std::shared_ptr<ConfigLayer> layer = std::make_shared<ConfigLayer>(this->make_arena());
 
+    layer->file_name = file_name;
+    layer->file_size = file_size;
+    layer->write_time = write_time;
+    layer->read_time = std::experimental::filesystem::file_time_type::clock::now();
+    layer->lazy_values = this->_options.lazy_values;
 
-void ReadConfig::get_parameter(std::string int_arr_value_name, int *int_arr_value, int int_arr_size)
-{    
-    std::vector<std::string> temp_str_vector;
-    int result = -1;
-    
-    if(!this->data_size_tested) this->check_data_size();
+    // A published snapshot has to stay the same while the file changes. With the hot reload the file is rewritten
+    // while it is used, which would change the mapped text under the readers, or end them with SIGBUS if the file
+    // shrinks. So the file is read into the arena of the layer, as in the buffered load mode but without its limit.
+    bool mapped = this->_options.load_mode == LoadMode::MemoryMapped && !this->_options.hot_reload;
 
-    if (this->data_size_ok)
+    if (mapped)
     {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
-        {
-            result = this->raw_config.at(i).compare(int_arr_value_name);
+        // Map the file and tokenize it directly from the mapping, so the file is never copied into the heap.
+        std::string error;
 
-            if (result == 0)
-            {
-                std::string temp_str;
-                
-                temp_str = this->raw_config.at(i+1);
-            
-                // Remove the brackets from the string.
-                char delete_chars[] = "()[]{}";
-                
-                for (int i = 0; i < sizeof(delete_chars)/sizeof(delete_chars[0]); i++)
-                {
-                    temp_str.erase (std::remove(temp_str.begin(), temp_str.end(), delete_chars[i]), temp_str.end());
-                }
-                
-                // Store all numbers seperated by commata or space in the array fields.
-                temp_str_vector = split(temp_str, ",", " ");
-                
-                if (temp_str_vector.size() != int_arr_size)
-                {
-                    std::cout << "Error in reading parameter for " << int_arr_value_name.c_str() <<
-                    ". Size of the requested array doesn't fit the size of the one in the " <<
-                    "configuration file. The size of the array in the executable requested " << int_arr_size <<
-                    " fields and the array in the file has " << temp_str_vector.size() << "fields." <<  
-                    "Please check the code and file or have a look in the example file." << std::endl;
-                    
-                    return;
-                }
-                else
-                {
-                    for (int i = 0; i < temp_str_vector.size(); i++)
-                    {                    
-                        int_arr_value[i] = std::stoi(temp_str_vector.at(i));
-                    }
-                }
-
-                std::cout << "Parameter for " << int_arr_value_name.c_str() << " is: [";
-
-                for (int i = 0; i < int_arr_size; i++)
-                {
-                    std::cout << int_arr_value[i]; 
-            
-                    if (i < int_arr_size - 1) std::cout << ", ";
-                }
-                
-                std::cout << "]" << std::endl;
-
-                return;
-            }
+        if (!layer->mapped_file.open(file_name, error))
+        {
+            this->report(Severity::Error, "", "Error while mapping the configuration file. ", error);
+            return nullptr;
         }
     }
-
-    if (result != 0)
+    else
     {
-        std::cout << "Could not find the parameter for " << int_arr_value_name.c_str() << ". Using instead the " <<
-        "initial value: [";
-        
-        for (int i = 0; i < int_arr_size; i++)
+        if(file_size > 1048576 && this->_options.load_mode != LoadMode::MemoryMapped)
         {
-            std::cout << int_arr_value[i]; 
-            
-            if (i < int_arr_size - 1) std::cout << ", ";
+            this->report(Severity::Error, "", "Size exceeds the limit of 1 MB. Stop reading the file. Use the " ,
+                         "memory mapped load mode for bigger files.");
+            return nullptr;
         }
-        
-        std::cout << "]" << std::endl;
-    }
 
-    return;
-}
+        // Read the text file in one owned buffer, all names and values are views into it.
+        std::ifstream text_config(file_name, std::ios::binary);
 
+        if (!text_config)
+        {
+            this->report(Severity::Error, "", "Error while opening the configuration file.");
+            return nullptr;
+        }
 
-void ReadConfig::get_parameter(std::string float_arr_value_name, float *float_arr_value, int float_arr_size)
-{    
-    std::vector<std::string> temp_str_vector;
-    int result = -1;
-    
-    if(!this->data_size_tested) this->check_data_size();
+        text_config.seekg(0, std::ios::end);
 
-    if (this->data_size_ok)
-    {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
+        std::streamoff end = text_config.tellg();
+
+        // The file could be deleted or truncated between the status above and the read.
+        if (end < 0)
         {
-            result = this->raw_config.at(i).compare(float_arr_value_name);
+            this->report(Severity::Error, "", "Error while reading the size of the configuration file.");
+            return nullptr;
+        }
 
-            if (result == 0)
-            {
-                std::string temp_str;
-                
-                temp_str = this->raw_config.at(i+1);
-            
-                // Remove the brackets from the string.
-                char delete_chars[] = "()[]{}";
-                
-                for (int i = 0; i < sizeof(delete_chars)/sizeof(delete_chars[0]); i++)
-                {
-                    temp_str.erase (std::remove(temp_str.begin(), temp_str.end(), delete_chars[i]), temp_str.end());
-                }
-                
-                // Store all numbers seperated by commata or space in the array fields.
-                temp_str_vector = split(temp_str, ",", " ");
-                
-                if (temp_str_vector.size() != float_arr_size)
-                {
-                    std::cout << "Error in reading parameter for " << float_arr_value_name.c_str() <<
-                    ". Size of the requested array doesn't fit the size of the one in the " <<
-                    "configuration file. The size of the array in the executable requested " << float_arr_size <<
-                    " fields and the array in the file has " << temp_str_vector.size() << "fields." <<  
-                    "Please check the code and file or have a look in the example file." << std::endl;
-                    
-                    return;
-                }
-                else
-                {
-                    for (int i = 0; i < temp_str_vector.size(); i++)
-                    {                    
-                        float_arr_value[i] = std::stof(temp_str_vector.at(i));
-                    }
-                }
-
-                std::cout << "Parameter for " << float_arr_value_name.c_str() << " is: [";
-
-                for (int i = 0; i < float_arr_size; i++)
-                {
-                    std::cout << float_arr_value[i]; 
-            
-                    if (i < float_arr_size - 1) std::cout << ", ";
-                }
-                
-                std::cout << "]" << std::endl;
-
-                return;
-            }
+        size_t size = static_cast<size_t>(end);
+
+        layer->buffer.assign(size, ' ');
+
+        text_config.seekg(0);
+
+        text_config.read(&layer->buffer[0], size);
+
+        if (text_config.gcount() != end)
+        {
+            this->report(Severity::Error, "", "Error while reading the configuration file. Read ",
+                         text_config.gcount(), " of ", size, " Bytes.");
+            return nullptr;
         }
     }
 
-    if (result != 0)
+    this->load_stats.files++;
+    this->load_stats.bytes += file_size;
+    this->load_stats.read_ms += milliseconds_since(start);
+
+    start = Clock::now();
+
+    if (this->_options.incremental_reload)
     {
-        std::cout << "Could not find the parameter for " << float_arr_value_name.c_str() << ". Using instead the " << 
-        "initial value: [";
-        
-        for (int i = 0; i < float_arr_size; i++)
+        // Only the blocks which the last version of the file doesn't have are tokenized.
+        const ConfigLayer *previous = (cached != this->layer_cache.end()) ? cached->second.get() : nullptr;
+        std::size_t size = layer->buffer.empty() ? layer->mapped_file.size() : layer->buffer.size();
+
+        split_blocks(layer->buffer.empty() ? layer->mapped_file.data() : layer->buffer.data(), size, layer->blocks);
+
+        std::size_t tokenized_size = tokenize_blocks(*layer, previous, thread_count);
+
+        if (previous != nullptr)
         {
-            std::cout << float_arr_value[i]; 
-            
-            if (i < float_arr_size - 1) std::cout << ", ";
+            this->report(Severity::Info, "", "Tokenized ", tokenized_size, " of ", size,
+                         " Bytes again, the other blocks are unchanged.");
         }
-        
-        std::cout << "]" << std::endl;
     }
+    else if (this->_options.lazy_values)
+    {
+        // Only the names are split off, the values are cleaned when they are read.
+        const char *text = layer->buffer.empty() ? layer->mapped_file.data() : layer->buffer.data();
+        std::size_t size = layer->buffer.empty() ? layer->mapped_file.size() : layer->buffer.size();
 
-    return;
-}
+        tokenize_config_lazy(text, size, layer->raw_config, layer->spills, thread_count);
+    }
+    else if (mapped)
+    {
+        tokenize_config(layer->mapped_file.data(), layer->mapped_file.size(), layer->raw_config, layer->spills,
+                        thread_count);
+    }
+    else
+    {
+        // Seperate the variables from the string and remove the comments in the same pass.
+        tokenize_config(&layer->buffer[0], layer->buffer.size(), layer->raw_config, thread_count);
+    }
+
+    this->load_stats.tokenize_ms += milliseconds_since(start);
+
+    find_includes(file_name, layer->raw_config, layer->includes);
+
+    layer->format_ok = layer->raw_config.size()%2 == 0;
 
+    if (!layer->format_ok)
+    {
+        this->report(Severity::Error, "",
+                     "\n",
+                     "######### ERROR #########\n",
+                     "The configuration file has one or more wrong parameter.\n",
+                     "Limitations: There are no spaces in the path string allowed. ",
+                     "Comments are also not allowed.\n",
+                     "\n",
+                     "Here an example of an allowed format:\n",
+                     "\n",
+                     "path: /home/USERNAME/workspace/blubb\n",
+                     "number_int: 12\n",
+                     "number_float: 4234.234234\n",
+                     "number_bool_1: 1\n",
+                     "number_bool_2: false\n",
+                     "number_array: [2,3,4.5]\n",
+                     "list: {Hello, World, !}\n");
+    }
+
+    loaded.emplace(file_name, layer);
+
+    return layer;
+}
 
-void ReadConfig::get_parameter(std::string char_arr_value_name, char *char_arr_value, int char_arr_size)
+void ReadConfig::merge_layers(ConfigSnapshot &snapshot, const std::vector<std::shared_ptr<ConfigLayer>> &layers)
 {
-    std::vector<std::string> temp_str_vector;
-    int result = -1;
-    
-    if(!this->data_size_tested) this->check_data_size();
+    std::size_t token_count = 0;
+
+    for (const std::shared_ptr<ConfigLayer> &layer : layers) token_count += layer->raw_config.size();
 
-    if (this->data_size_ok)
+    snapshot.raw_config.reserve(token_count);
+    prepare_index(snapshot, token_count / 2);
+
+    // The layer with the highest priority comes first, so the first entry of a name wins like inside one file. The
+    // names keep the hashes of their layer. The include directives are no parameters and a name without a value at
+    // the end of a layer is left out, so the names stay on the even positions.
+    for (auto layer = layers.rbegin(); layer != layers.rend(); ++layer)
     {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
+        const std::pmr::vector<std::string_view> &tokens = (*layer)->raw_config;
+
+        for (std::size_t i = 0; i + 1 < tokens.size(); i = i + 2)
         {
-            result = this->raw_config.at(i).compare(char_arr_value_name);
+            if (tokens[i] == include_directive) continue;
 
-            if (result == 0)
-            {
-                std::string temp_str;
-                
-                temp_str = this->raw_config.at(i+1);
-            
-                // Remove the brackets from the string.
-                char delete_chars[] = "()[]{}";
-                
-                for (int i = 0; i < sizeof(delete_chars)/sizeof(delete_chars[0]); i++)
-                {
-                    temp_str.erase (std::remove(temp_str.begin(), temp_str.end(), delete_chars[i]), temp_str.end());
-                }
-                
-                // Store all characters seperated by commata or space in the array fields.
-                temp_str_vector = split(temp_str, ",", " ");
-                
-                if (temp_str_vector.size() != char_arr_size)
-                {
-                    std::cout << "Error in reading parameter for " << char_arr_value_name.c_str() <<
-                    ". Size of the requested array doesn't fit the size of the one in the " << 
-                    "configuration file. The size of the array in the executable requested " << char_arr_size <<
-                    " fields and the array in the file has " << temp_str_vector.size() << "fields." <<  
-                    "Please check the code and file or have a look in the example file." << std::endl;
-                    
-                    return;
-                }
-                else
-                {   
-                    char temp_char[1];
-                             
-                    for (int i = 0; i < temp_str_vector.size(); i++)
-                    {   
-                        if (temp_str_vector.at(i).size() == 1)
-                        {
-                            strcpy(temp_char, temp_str_vector.at(i).c_str());
-                            
-                            char_arr_value[i] = temp_char[0];
-                        }
-                        else
-                        {
-                            result = -1;
-                            
-                            std::cout << "Error in reading parameter for " << char_arr_value_name.c_str() <<
-                            ". Size of field  " << i << " has none or more than one character. Halt..." <<
-                            std::endl;
-                            
-                            return;
-                        }
-                    } 
-                }
-
-                std::cout << "Parameter for " << char_arr_value_name.c_str() << " is: [";
-
-                for (int i = 0; i < char_arr_size; i++)
-                {
-                    std::cout << char_arr_value[i]; 
-            
-                    if (i < char_arr_size - 1) std::cout << ", ";
-                }
-                
-                std::cout << "]" << std::endl;
-
-                return;
-            }
+            index_name(snapshot, tokens[i], (*layer)->hashes[i / 2],
+                       static_cast<std::uint32_t>(snapshot.raw_config.size() + 1));
+            snapshot.raw_config.push_back(tokens[i]);
+            snapshot.raw_config.push_back(tokens[i + 1]);
         }
     }
+}
+
+bool ReadConfig::compact_layers(ConfigSnapshot &snapshot, const std::vector<std::shared_ptr<ConfigLayer>> &layers)
+{
+    std::size_t entry_count = 0;
+    std::size_t text_size = 0;
 
-    if (result != 0)
+    for (const std::shared_ptr<ConfigLayer> &layer : layers)
     {
-        std::cout << "Could not find the parameter for " << char_arr_value_name.c_str() << ". Using instead the " << 
-        "initial value: [";
-        
-        for (int i = 0; i < char_arr_size; i++)
+        entry_count += layer->raw_config.size() / 2;
+
+        // The spaces of arrays and lazily split values aren't copied, so they aren't reserved either.
+        for (std::string_view token : layer->raw_config)
         {
-            std::cout << char_arr_value[i]; 
-            
-            if (i < char_arr_size - 1) std::cout << ", ";
+            text_size += token.size() - static_cast<std::size_t>(std::count(token.begin(), token.end(), ' '));
         }
-        
-        std::cout << "]" << std::endl;
     }
 
-    return;
-}
-
+    if (!snapshot.compact.reserve(entry_count, text_size)) return false;
 
-void ReadConfig::get_parameter(std::string str_arr_value_name, std::string *str_array_value, int str_arr_size)
-{
-    std::vector<std::string> temp_str_vector;
-    int result = -1;
-    
-    if(!this->data_size_tested) this->check_data_size();
-
-    if (this->data_size_ok)
+    // The layer with the highest priority comes first, as in merge_layers(), and the store keeps the first entry of a
+    // name. The layers which were hashed for the merge keep their hashes.
+    for (auto layer = layers.rbegin(); layer != layers.rend(); ++layer)
     {
-        for (int i = 0; i < this->raw_config.size(); i=i+2)
+        const std::pmr::vector<std::string_view> &tokens = (*layer)->raw_config;
+        bool hashed = (*layer)->hashes.size() == tokens.size() / 2;
+
+        for (std::size_t i = 0; i + 1 < tokens.size(); i = i + 2)
         {
-            result = this->raw_config.at(i).compare(str_arr_value_name);
+            if (tokens[i] == include_directive) continue;
 
-            if (result == 0)
-            {
-                std::string temp_str;
-                
-                temp_str = this->raw_config.at(i+1);
-            
-                // Remove the brackets from the string.
-                char delete_chars[] = "()[]{}";
-                
-                for (int i = 0; i < sizeof(delete_chars)/sizeof(delete_chars[0]); i++)
-                {
-                    temp_str.erase (std::remove(temp_str.begin(), temp_str.end(), delete_chars[i]), temp_str.end());
-                }
-                
-                // Store all characters seperated by commata or space in the array fields.
-                temp_str_vector = split(temp_str, ",", " ");
-                
-                if (temp_str_vector.size() != str_arr_size)
-                {
-                    std::cout << "Error in reading parameter for " << str_arr_value_name.c_str() <<
-                    ". Size of the requested array doesn't fit the size of the one in the " << 
-                    "configuration file. The size of the array in the executable requested " << str_arr_size <<
-                    " fields and the array in the file has " << temp_str_vector.size() << "fields." <<  
-                    "Please check the code and file or have a look in the example file." << std::endl;
-                    
-                    return;
-                }
-                else
-                {   
-                    for (int i = 0; i < temp_str_vector.size(); i++)
-                    {                    
-                        str_array_value[i] = temp_str_vector.at(i);
-                    }
-                }
-
-                std::cout << "Parameter for " << str_arr_value_name.c_str() << " is: [";
-
-                for (int i = 0; i < str_arr_size; i++)
-                {
-                    std::cout << str_array_value[i]; 
-            
-                    if (i < str_arr_size - 1) std::cout << ", ";
-                }
-                
-                std::cout << "]" << std::endl;
-
-                return;
-            }
+            std::uint64_t name_hash = hashed ? (*layer)->hashes[i / 2] : KeyIndex::hash(tokens[i]);
+
+            snapshot.compact.add(tokens[i], name_hash, tokens[i + 1]);
         }
     }
 
-    if (result != 0)
+    if (snapshot.schema)
     {
-        std::cout << "Could not find the parameter for " << str_arr_value_name.c_str() << ". Using instead the " << 
-        "initial value: [";
-        
-        for (int i = 0; i < str_arr_size; i++)
+        // The fields of the schema keep their perfect hash, a position has the same form as in the key index.
+        snapshot.schema_positions.assign(snapshot.schema->size(), KeyIndex::npos);
+
+        for (std::uint32_t field = 0; field < snapshot.schema->size(); field++)
         {
-            std::cout << str_array_value[i].c_str(); 
-            
-            if (i < str_arr_size - 1) std::cout << ", ";
+            const std::string &name = snapshot.schema->field(field).name;
+            std::uint32_t entry = snapshot.compact.find(name, KeyIndex::hash(name));
+
+            if (entry != CompactStore::npos) snapshot.schema_positions[field] = 2 * entry + 1;
         }
-        
-        std::cout << "]" << std::endl;
     }
 
-    return;
+    return true;
 }
 
+void ReadConfig::hash_names(const std::pmr::vector<std::string_view> &raw_config,
+                            std::pmr::vector<std::uint64_t> &hashes, unsigned thread_count)
+{
+    std::size_t name_count = raw_config.size() / 2;
+
+    hashes.resize(name_count);
+
+    auto hash_range = [&raw_config, &hashes](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; i++) hashes[i] = KeyIndex::hash(raw_config[2 * i]);
+    };
+
+    // Below this number of names a thread costs more than it saves.
+    if (thread_count <= 1 || name_count < 65536)
+    {
+        hash_range(0, name_count);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+
+    for (unsigned t = 1; t < thread_count; t++)
+    {
+        threads.emplace_back(hash_range, name_count * t / thread_count, name_count * (t + 1) / thread_count);
+    }
+
+    hash_range(0, name_count / thread_count);
+
+    for (std::thread &thread : threads) thread.join();
+}
+
+void ReadConfig::build_index(ConfigSnapshot &snapshot, unsigned thread_count)
+{
+    std::size_t name_count = snapshot.raw_config.size() / 2;
+
+    prepare_index(snapshot, name_count);
+
+    // Below this number of names a thread costs more than it saves.
+    if (thread_count <= 1 || name_count < 65536)
+    {
+        // Names are on the even positions and their values follow directly. A name without a value is not indexed.
+        for (std::size_t i = 0; i + 1 < snapshot.raw_config.size(); i = i + 2)
+        {
+            index_name(snapshot, snapshot.raw_config[i], KeyIndex::hash(snapshot.raw_config[i]),
+                       static_cast<std::uint32_t>(i + 1));
+        }
+
+        return;
+    }
+
+    // Hash the names on all threads, then insert them in the order of the file, so the first entry of a name still
+    // wins. The insertion only compares hashes and names, so the hashing is most of the work for long names.
+    std::pmr::vector<std::uint64_t> hashes;
+
+    hash_names(snapshot.raw_config, hashes, thread_count);
+
+    for (std::size_t i = 0; i < name_count; i++)
+    {
+        index_name(snapshot, snapshot.raw_config[2 * i], hashes[i], static_cast<std::uint32_t>(2 * i + 1));
+    }
+}
+
+void ReadConfig::prepare_index(ConfigSnapshot &snapshot, std::size_t name_count)
+{
+    snapshot.key_index.clear();
+
+    if (!snapshot.schema)
+    {
+        snapshot.key_index.reserve(name_count);
+        return;
+    }
+
+    // Usually most names are in the schema, only the others go into the key index.
+    snapshot.key_index.reserve(name_count - std::min(name_count, snapshot.schema->size()));
+    snapshot.schema_positions.assign(snapshot.schema->size(), KeyIndex::npos);
+}
+
+void ReadConfig::index_name(ConfigSnapshot &snapshot, std::string_view name, std::uint64_t name_hash,
+                            std::uint32_t position)
+{
+    if (snapshot.schema)
+    {
+        std::uint32_t field = snapshot.schema->find(name, name_hash);
+
+        if (field != ConfigSchema::npos)
+        {
+            // The first entry of a name wins, as in the key index.
+            if (snapshot.schema_positions[field] == KeyIndex::npos) snapshot.schema_positions[field] = position;
+
+            return;
+        }
+    }
+
+    snapshot.key_index.insert(name, name_hash, position);
+}
+
+std::uint32_t ReadConfig::find_entry(const ConfigSnapshot &snapshot, const ConfigKey &key)
+{
+    std::uint32_t position;
+    std::uint32_t field = snapshot.schema ? snapshot.schema->find(key) : ConfigSchema::npos;
+
+    // A name of the schema has its own slot of the perfect hash, so it is found without probing. A missing parameter
+    // of the schema isn't searched in the key index either, because that only has the other names.
+    if (field != ConfigSchema::npos) position = snapshot.schema_positions[field];
+    else if (!snapshot.compact.empty()) return snapshot.compact.find(key.name(), key.hash());
+    else position = snapshot.key_index.find(key.name(), key.hash());
+
+    // The names and values are alternating, so a value is at the odd position of its entry.
+    return position == KeyIndex::npos ? KeyIndex::npos : position / 2;
+}
+
+void ReadConfig::check_schema(const ConfigSnapshot &snapshot) const
+{
+    const ConfigSchema &schema = *this->_options.schema;
+    std::size_t unknown_count = 0;
+    std::size_t missing_count = 0;
+    std::size_t invalid_count = 0;
+
+    auto report_unknown = [this, &unknown_count](std::string_view name)
+    {
+        this->report(Severity::Warning, name, "The parameter ", name, " is not in the schema.");
+        unknown_count++;
+    };
+
+    if (snapshot.image.is_open())
+    {
+        for (std::uint32_t i = 0; i < snapshot.image.size(); i++)
+        {
+            std::string_view name = snapshot.image.name(i);
+
+            if (schema.find(name, KeyIndex::hash(name)) == ConfigSchema::npos) report_unknown(name);
+        }
+    }
+    else if (!snapshot.compact.empty())
+    {
+        // The store has every name once.
+        for (std::uint32_t i = 0; i < snapshot.compact.size(); i++)
+        {
+            std::string_view name = snapshot.compact.name(i);
+
+            if (schema.find(name, KeyIndex::hash(name)) == ConfigSchema::npos) report_unknown(name);
+        }
+    }
+    else if (snapshot.key_index.size() > 0)
+    {
+        // The key index only has the names which aren't in the schema. A name which is there twice is reported once.
+        for (std::size_t i = 0; i + 1 < snapshot.raw_config.size(); i = i + 2)
+        {
+            if (snapshot.key_index.find(snapshot.raw_config[i]) == i + 1) report_unknown(snapshot.raw_config[i]);
+        }
+    }
+
+    // Every field is converted to its type, so its value is checked now and already in the cache for the first read.
+    for (std::size_t i = 0; i < schema.size(); i++)
+    {
+        const ConfigSchema::Field &field = schema.field(schema.declared(i));
+        ConfigKey key(field.name);
+
+        // Only the type of the null pointer matters, it chooses the conversion.
+        auto convert = [this, &snapshot, &key](auto *type)
+        {
+            const std::remove_pointer_t<decltype(type)> *value = nullptr;
+
+            return this->find_converted(snapshot, key, value);
+        };
+
+        Lookup result = Lookup::Missing;
+
+        switch (field.type)
+        {
+            case ParameterType::String: result = convert(static_cast<std::pmr::string *>(nullptr)); break;
+            case ParameterType::Char: result = convert(static_cast<char *>(nullptr)); break;
+            case ParameterType::Int: result = convert(static_cast<int *>(nullptr)); break;
+            case ParameterType::Float: result = convert(static_cast<float *>(nullptr)); break;
+            case ParameterType::Bool: result = convert(static_cast<bool *>(nullptr)); break;
+            case ParameterType::IntArray: result = convert(static_cast<std::pmr::vector<int> *>(nullptr)); break;
+            case ParameterType::FloatArray: result = convert(static_cast<std::pmr::vector<float> *>(nullptr)); break;
+            case ParameterType::CharArray: result = convert(static_cast<std::pmr::vector<char> *>(nullptr)); break;
+            case ParameterType::StringArray:
+                result = convert(static_cast<std::pmr::vector<std::pmr::string> *>(nullptr));
+                break;
+        }
+
+        if (result == Lookup::Missing)
+        {
+            this->report(Severity::Warning, field.name, "The parameter ", field.name, " of the schema is missing.");
+            missing_count++;
+        }
+        else if (result == Lookup::Invalid)
+        {
+            this->report(Severity::Error, field.name, "The value of the parameter ", field.name,
+                         " is no valid value of the type ", ConfigSchema::type_name(field.type), " of the schema.");
+            invalid_count++;
+        }
+    }
+
+    if (unknown_count + missing_count + invalid_count == 0)
+    {
+        this->report(Severity::Info, "", "The configuration matches the schema.");
+    }
+    else
+    {
+        this->report(Severity::Warning, "", "The configuration doesn't match the schema: ", unknown_count,
+                     " unknown, ", missing_count, " missing and ", invalid_count, " invalid parameters.");
+    }
+}
+
+bool ReadConfig::find_value(const ConfigSnapshot &snapshot, const ConfigKey &key, std::string_view &value)
+{
+    if (snapshot.image.is_open())
+    {
+        std::uint32_t entry = snapshot.image.find(key);
+
+        value = snapshot.image.text(entry);
+
+        return entry != ConfigImage::npos;
+    }
+
+    std::uint32_t entry = find_entry(snapshot, key);
+
+    if (entry == KeyIndex::npos) return false;
+
+    value = value_text(snapshot, entry);
+
+    return true;
+}
+
+std::string_view ReadConfig::value_text(const ConfigSnapshot &snapshot, std::uint32_t entry)
+{
+    // The compact storage has no spaces in its values.
+    if (!snapshot.compact.empty()) return snapshot.compact.value(entry);
+
+    std::string_view text = snapshot.raw_config[2 * entry + 1];
+
+    // Arrays keep their spaces, as in the memory mapped load mode. The array parsing skips them anyway.
+    if (!snapshot.lazy_values || text.find(' ') == std::string_view::npos || text[0] == '(' || text[0] == '[' ||
+        text[0] == '{')
+    {
+        return text;
+    }
+
+    // The value without its spaces is the string conversion of the entry, so it is cleaned only once.
+    const std::pmr::string *cleaned = snapshot.typed_values.find<std::pmr::string>(entry);
+
+    if (cleaned == nullptr)
+    {
+        std::pmr::string converted = snapshot.typed_values.make_value<std::pmr::string>();
+
+        parse_value(text, converted);
+        cleaned = snapshot.typed_values.insert(entry, std::move(converted));
+    }
+
+    return *cleaned;
+}
+
+template <typename T>
+ReadConfig::Lookup ReadConfig::lookup(const ConfigSnapshot &snapshot, const ConfigKey &key, const T *&value) const
+{
+    Lookup result = this->find_converted(snapshot, key, value);
+
+    // Without statistics, this check is all the instrumentation costs.
+    if (this->stats)
+    {
+        this->stats->count_lookup(key, parameter_type(value), result == Lookup::Missing, result == Lookup::Invalid);
+    }
+
+    return result;
+}
+
+template <typename T>
+ReadConfig::Lookup ReadConfig::find_converted(const ConfigSnapshot &snapshot, const ConfigKey &key,
+                                              const T *&value) const
+{
+    if (!snapshot.data_size_ok) return Lookup::Missing;
+
+    std::uint32_t entry;
+
+    if (snapshot.image.is_open())
+    {
+        entry = snapshot.image.find(key);
+
+        if (entry == ConfigImage::npos) return Lookup::Missing;
+
+        // Numbers, booleans and characters were converted by the compiler and are read directly from the image.
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            return snapshot.image.scalar(entry, value) ? Lookup::Found : Lookup::Invalid;
+        }
+    }
+    else
+    {
+        entry = find_entry(snapshot, key);
+
+        if (entry == KeyIndex::npos) return Lookup::Missing;
+    }
+
+    // Every entry keeps its conversions. Only the first read as a type converts the text, later reads only load an
+    // atomic pointer, so reading threads never write to shared memory after the first read.
+    value = snapshot.typed_values.find<T>(entry);
+
+    if (value == nullptr)
+    {
+        T converted = snapshot.typed_values.make_value<T>();
+        bool valid;
+
+        if (snapshot.image.is_open())
+        {
+            valid = snapshot.image.convert(entry, converted);
+        }
+        else
+        {
+            std::string_view text = value_text(snapshot, entry);
+
+            // Cleaning a lazily split value already added its string conversion.
+            if constexpr (std::is_same_v<T, std::pmr::string>)
+            {
+                value = snapshot.typed_values.find<T>(entry);
+
+                if (value != nullptr) return Lookup::Found;
+            }
+
+            valid = parse_value(text, converted);
+        }
+
+        if (!valid) return Lookup::Invalid;
+
+        value = snapshot.typed_values.insert(entry, std::move(converted));
+    }
+
+    return Lookup::Found;
+}
+
+template <typename T>
+std::size_t ReadConfig::invalid_field(const ConfigSnapshot &snapshot, const ConfigKey &key)
+{
+    // Convert the text once more to find the invalid field. This is only done in case of an error.
+    std::string_view text;
+    std::vector<T> valid_fields;
+
+    find_value(snapshot, key, text);
+    parse_value(text, valid_fields);
+
+    return valid_fields.size();
+}
+
+void ReadConfig::get_parameter(const ConfigKey &int_value_key, int &int_value) const
+{
+    std::string_view int_value_name = int_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const int *value = nullptr;
+    Lookup result = this->lookup(*snapshot, int_value_key, value);
+
+    if (result == Lookup::Found)
+    {
+        int_value = *value;
+
+        this->report(Severity::Info, int_value_name, "Parameter for ", int_value_name, " is: ", int_value);
+    }
+    else if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, int_value_name, "Cannot read the value of the parameter ", int_value_name,
+                     " as a number. Using instead the initial value: ", int_value);
+    }
+    else
+    {
+        this->report(Severity::Warning, int_value_name, "Could not find the parameter for ", int_value_name,
+                     ". Using instead the initial value: ", int_value);
+    }
+}
+
+
+void ReadConfig::get_parameter(const ConfigKey &char_value_key, char &char_value) const
+{
+    std::string_view char_value_name = char_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const char *value = nullptr;
+    Lookup result = this->lookup(*snapshot, char_value_key, value);
+
+    if (result == Lookup::Found)
+    {
+        char_value = *value;
+
+        this->report(Severity::Info, char_value_name, "Parameter for ", char_value_name, " is: ", char_value);
+    }
+    else if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, char_value_name, "Only one character expected for the parameter ",
+                     char_value_name, ", but found more than one. Using instead the initial value: ", char_value);
+    }
+    else
+    {
+        this->report(Severity::Warning, char_value_name, "Could not find the parameter for ", char_value_name,
+                     ". Using instead the initial value: ", char_value);
+    }
+}
+
+
+void ReadConfig::get_parameter(const ConfigKey &float_value_key, float &float_value) const
+{
+    std::string_view float_value_name = float_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const float *value = nullptr;
+    Lookup result = this->lookup(*snapshot, float_value_key, value);
+
+    if (result == Lookup::Found)
+    {
+        float_value = *value;
+
+        this->report(Severity::Info, float_value_name, "Parameter for ", float_value_name, " is: ", float_value);
+    }
+    else if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, float_value_name, "Cannot read the value of the parameter ", float_value_name,
+                     " as a number. Using instead the initial value: ", float_value);
+    }
+    else
+    {
+        this->report(Severity::Warning, float_value_name, "Could not find the parameter for ", float_value_name,
+                     ". Using instead the initial value: ", float_value);
+    }
+}
+
+void ReadConfig::get_parameter(const ConfigKey &str_value_key, std::string &str_value) const
+{
+    std::string_view str_value_name = str_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const std::pmr::string *value = nullptr;
+
+    if (this->lookup(*snapshot, str_value_key, value) == Lookup::Found)
+    {
+        str_value = *value;
+
+        this->report(Severity::Info, str_value_name, "Parameter for ", str_value_name, " is: ", str_value);
+    }
+    else
+    {
+        this->report(Severity::Warning, str_value_name, "Could not find the parameter for ", str_value_name,
+                     ". Using instead the initial value: ", str_value);
+    }
+}
+
+void ReadConfig::get_parameter(const ConfigKey &bool_value_key, bool &bool_value) const
+{
+    std::string_view bool_value_name = bool_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const bool *value = nullptr;
+    Lookup result = this->lookup(*snapshot, bool_value_key, value);
+
+    if (result == Lookup::Found)
+    {
+        bool_value = *value;
+
+        this->report(Severity::Info, bool_value_name, "Parameter for ", bool_value_name, " is: ",
+                     bool_value ? "true" : "false");
+    }
+    else if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, bool_value_name, "Cannot read the value! Allowed values are: 0, 1, true, ",
+                     "false, TRUE and FALSE.");
+    }
+    else
+    {
+        this->report(Severity::Warning, bool_value_name, "Could not find the parameter for ", bool_value_name,
+                     ". Using instead the initial value: ", bool_value);
+    }
+}
+
+
+void ReadConfig::get_parameter(const ConfigKey &int_arr_value_key, int *int_arr_value, int int_arr_size) const
+{
+    std::string_view int_arr_value_name = int_arr_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const std::pmr::vector<int> *values = nullptr;
+    Lookup result = this->lookup(*snapshot, int_arr_value_key, values);
+
+    if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, int_arr_value_name, "Error in reading parameter for ", int_arr_value_name,
+                     ". Field ", invalid_field<int>(*snapshot, int_arr_value_key), " is not a valid number. Using ",
+                     "instead the initial values.");
+    }
+    else if (result == Lookup::Found && values->size() != static_cast<std::size_t>(int_arr_size))
+    {
+        this->report(Severity::Error, int_arr_value_name, "Error in reading parameter for ", int_arr_value_name,
+                     ". Size of the requested array doesn't fit the size of the one in the configuration file. ",
+                     "The size of the array in the executable requested ", int_arr_size, " fields and the array ",
+                     "in the file has ", values->size(), "fields.", "Please check the code and file or have a ",
+                     "look in the example file.");
+    }
+    else if (result == Lookup::Found)
+    {
+        std::copy(values->begin(), values->end(), int_arr_value);
+
+        this->report(Severity::Info, int_arr_value_name, "Parameter for ", int_arr_value_name, " is: ",
+                     array_text(int_arr_value, int_arr_size));
+    }
+    else
+    {
+        this->report(Severity::Warning, int_arr_value_name, "Could not find the parameter for ", int_arr_value_name,
+                     ". Using instead the initial value: ", array_text(int_arr_value, int_arr_size));
+    }
+}
+
+
+void ReadConfig::get_parameter(const ConfigKey &float_arr_value_key, float *float_arr_value, int float_arr_size) const
+{
+    std::string_view float_arr_value_name = float_arr_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const std::pmr::vector<float> *values = nullptr;
+    Lookup result = this->lookup(*snapshot, float_arr_value_key, values);
+
+    if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, float_arr_value_name, "Error in reading parameter for ", float_arr_value_name,
+                     ". Field ", invalid_field<float>(*snapshot, float_arr_value_key), " is not a valid number. ",
+                     "Using instead the initial values.");
+    }
+    else if (result == Lookup::Found && values->size() != static_cast<std::size_t>(float_arr_size))
+    {
+        this->report(Severity::Error, float_arr_value_name, "Error in reading parameter for ", float_arr_value_name,
+                     ". Size of the requested array doesn't fit the size of the one in the configuration file. ",
+                     "The size of the array in the executable requested ", float_arr_size, " fields and the array ",
+                     "in the file has ", values->size(), "fields.", "Please check the code and file or have a ",
+                     "look in the example file.");
+    }
+    else if (result == Lookup::Found)
+    {
+        std::copy(values->begin(), values->end(), float_arr_value);
+
+        this->report(Severity::Info, float_arr_value_name, "Parameter for ", float_arr_value_name, " is: ",
+                     array_text(float_arr_value, float_arr_size));
+    }
+    else
+    {
+        this->report(Severity::Warning, float_arr_value_name, "Could not find the parameter for ",
+                     float_arr_value_name, ". Using instead the initial value: ",
+                     array_text(float_arr_value, float_arr_size));
+    }
+}
+
+
+void ReadConfig::get_parameter(const ConfigKey &char_arr_value_key, char *char_arr_value, int char_arr_size) const
+{
+    std::string_view char_arr_value_name = char_arr_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const std::pmr::vector<char> *values = nullptr;
+    Lookup result = this->lookup(*snapshot, char_arr_value_key, values);
+
+    if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, char_arr_value_name, "Error in reading parameter for ", char_arr_value_name,
+                     ". Size of field  ", invalid_field<char>(*snapshot, char_arr_value_key), " has none or more ",
+                     "than one character. Halt...");
+    }
+    else if (result == Lookup::Found && values->size() != static_cast<std::size_t>(char_arr_size))
+    {
+        this->report(Severity::Error, char_arr_value_name, "Error in reading parameter for ", char_arr_value_name,
+                     ". Size of the requested array doesn't fit the size of the one in the configuration file. ",
+                     "The size of the array in the executable requested ", char_arr_size, " fields and the array ",
+                     "in the file has ", values->size(), "fields.", "Please check the code and file or have a ",
+                     "look in the example file.");
+    }
+    else if (result == Lookup::Found)
+    {
+        std::copy(values->begin(), values->end(), char_arr_value);
+
+        this->report(Severity::Info, char_arr_value_name, "Parameter for ", char_arr_value_name, " is: ",
+                     array_text(char_arr_value, char_arr_size));
+    }
+    else
+    {
+        this->report(Severity::Warning, char_arr_value_name, "Could not find the parameter for ",
+                     char_arr_value_name, ". Using instead the initial value: ",
+                     array_text(char_arr_value, char_arr_size));
+    }
+}
+
+
+void ReadConfig::get_parameter(const ConfigKey &str_arr_value_key, std::string *str_array_value, int str_arr_size) const
+{
+    std::string_view str_arr_value_name = str_arr_value_key.name();
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const std::pmr::vector<std::pmr::string> *values = nullptr;
+    Lookup result = this->lookup(*snapshot, str_arr_value_key, values);
+
+    if (result == Lookup::Found && values->size() != static_cast<std::size_t>(str_arr_size))
+    {
+        this->report(Severity::Error, str_arr_value_name, "Error in reading parameter for ", str_arr_value_name,
+                     ". Size of the requested array doesn't fit the size of the one in the configuration file. ",
+                     "The size of the array in the executable requested ", str_arr_size, " fields and the array ",
+                     "in the file has ", values->size(), "fields.", "Please check the code and file or have a ",
+                     "look in the example file.");
+    }
+    else if (result == Lookup::Found)
+    {
+        std::copy(values->begin(), values->end(), str_array_value);
+
+        this->report(Severity::Info, str_arr_value_name, "Parameter for ", str_arr_value_name, " is: ",
+                     array_text(str_array_value, str_arr_size));
+    }
+    else
+    {
+        this->report(Severity::Warning, str_arr_value_name, "Could not find the parameter for ",
+                     str_arr_value_name, ". Using instead the initial value: ",
+                     array_text(str_array_value, str_arr_size));
+    }
+}
+
+
+template <typename T>
+void ReadConfig::read_vector(const ConfigKey &key, std::vector<T> &values) const
+{
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const Stored<std::vector<T>> *found = nullptr;
+    Lookup result = this->lookup(*snapshot, key, found);
+
+    if (result == Lookup::Found)
+    {
+        // The vector takes the size of the array in the file, so the caller doesn't need to know it.
+        values.assign(found->begin(), found->end());
+
+        this->report(Severity::Info, key.name(), "Parameter for ", key.name(), " is: ",
+                     array_text(values.data(), static_cast<int>(values.size())));
+    }
+    else if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, key.name(), "Error in reading parameter for ", key.name(), ". Field ",
+                     invalid_field<T>(*snapshot, key), invalid_field_reason(values.data()),
+                     " Using instead the initial values.");
+    }
+    else
+    {
+        this->report(Severity::Warning, key.name(), "Could not find the parameter for ", key.name(),
+                     ". Using instead the initial value: ",
+                     array_text(values.data(), static_cast<int>(values.size())));
+    }
+}
+
+template <typename T>
+int ReadConfig::read_array(const ConfigKey &key, T *values, int capacity) const
+{
+    SnapshotDomain::Guard snapshot(this->snapshots);
+
+    const Stored<std::vector<T>> *found = nullptr;
+    Lookup result = this->lookup(*snapshot, key, found);
+
+    if (result == Lookup::Found && found->size() > static_cast<std::size_t>(std::max(capacity, 0)))
+    {
+        // The buffer is left as it is. The returned size tells the caller how big it has to be, so this is the
+        // normal first call of a caller which asks for the size and no error.
+        this->report(Severity::Info, key.name(), "The array for ", key.name(), " has ", found->size(),
+                     " fields, the buffer has room for ", capacity, ". The buffer is left unchanged.");
+    }
+    else if (result == Lookup::Found)
+    {
+        std::copy(found->begin(), found->end(), values);
+
+        this->report(Severity::Info, key.name(), "Parameter for ", key.name(), " is: ",
+                     array_text(values, static_cast<int>(found->size())));
+    }
+    else if (result == Lookup::Invalid)
+    {
+        this->report(Severity::Error, key.name(), "Error in reading parameter for ", key.name(), ". Field ",
+                     invalid_field<T>(*snapshot, key), invalid_field_reason(values),
+                     " Using instead the initial values.");
+        return -1;
+    }
+    else
+    {
+        this->report(Severity::Warning, key.name(), "Could not find the parameter for ", key.name(), ".");
+        return -1;
+    }
+
+    return static_cast<int>(found->size());
+}
+
+void ReadConfig::get_parameter(const ConfigKey &int_arr_value_key, std::vector<int> &int_arr_values) const
+{
+    this->read_vector(int_arr_value_key, int_arr_values);
+}
+
+void ReadConfig::get_parameter(const ConfigKey &float_arr_value_key, std::vector<float> &float_arr_values) const
+{
+    this->read_vector(float_arr_value_key, float_arr_values);
+}
+
+void ReadConfig::get_parameter(const ConfigKey &char_arr_value_key, std::vector<char> &char_arr_values) const
+{
+    this->read_vector(char_arr_value_key, char_arr_values);
+}
+
+void ReadConfig::get_parameter(const ConfigKey &str_arr_value_key, std::vector<std::string> &str_arr_values) const
+{
+    this->read_vector(str_arr_value_key, str_arr_values);
+}
+
+int ReadConfig::get_array(const ConfigKey &int_arr_value_key, int *int_arr_value, int capacity) const
+{
+    return this->read_array(int_arr_value_key, int_arr_value, capacity);
+}
+
+int ReadConfig::get_array(const ConfigKey &float_arr_value_key, float *float_arr_value, int capacity) const
+{
+    return this->read_array(float_arr_value_key, float_arr_value, capacity);
+}
+
+int ReadConfig::get_array(const ConfigKey &char_arr_value_key, char *char_arr_value, int capacity) const
+{
+    return this->read_array(char_arr_value_key, char_arr_value, capacity);
+}
+
+int ReadConfig::get_array(const ConfigKey &str_arr_value_key, std::string *str_array_value, int capacity) const
+{
+    return this->read_array(str_arr_value_key, str_array_value, capacity);
+}
+
+BindSummary ReadConfig::resolve(const ConfigBinding &binding) const
+{
+    return this->resolve(binding, "");
+}
+
+BindSummary ReadConfig::resolve(const ConfigBinding &binding, std::string prefix) const
+{
+    // All parameters are read from the same version of the file, even if it is reloaded in the meantime.
+    SnapshotDomain::Guard snapshot(this->snapshots);
+    BindSummary summary;
+    std::string name = prefix;
+
+    for (const ConfigBinding::Binding &entry : binding.bindings())
+    {
+        name.replace(prefix.size(), std::string::npos, entry.name);
+
+        ConfigKey key(name);
+
+        std::visit([&](auto destination) { this->bind_value(*snapshot, key, destination, summary); }, entry.target);
+    }
+
+    // One message for all parameters instead of one per parameter.
+    Severity severity = !summary.errors.empty() ? Severity::Error
+                                                : (!summary.missing.empty() ? Severity::Warning : Severity::Info);
+
+    this->report(severity, prefix, "Read ", summary.found, " of ", binding.size(), " bound parameters.",
+                 SummaryText{summary});
+
+    return summary;
+}
+
+std::vector<std::string> ReadConfig::get_keys(std::string prefix) const
+{
+    SnapshotDomain::Guard snapshot(this->snapshots);
+    std::vector<std::string> keys;
+
+    PrefixIndex::Range range = find_prefix(*snapshot, prefix);
+
+    keys.reserve(range.size());
+
+    for (const PrefixIndex::Entry &entry : range) keys.emplace_back(entry.name);
+
+    return keys;
+}
+
+PrefixIndex::Range ReadConfig::find_prefix(const ConfigSnapshot &snapshot, std::string_view prefix)
+{
+    // Most programs never ask for a prefix, so the names are only sorted by the first query of a version.
+    std::call_once(snapshot.prefix_once, [&snapshot]()
+    {
+        PrefixIndex &index = snapshot.prefix_index;
+
+        if (snapshot.image.is_open())
+        {
+            index.reserve(snapshot.image.size());
+
+            for (std::uint32_t i = 0; i < snapshot.image.size(); i++) index.add(snapshot.image.name(i), i);
+        }
+        else if (!snapshot.compact.empty())
+        {
+            index.reserve(snapshot.compact.size());
+
+            for (std::uint32_t i = 0; i < snapshot.compact.size(); i++) index.add(snapshot.compact.name(i), i);
+        }
+        else
+        {
+            index.reserve(snapshot.raw_config.size() / 2);
+
+            for (std::uint32_t i = 0; 2 * i + 1 < snapshot.raw_config.size(); i++)
+            {
+                index.add(snapshot.raw_config[2 * i], i);
+            }
+        }
+
+        index.sort();
+    });
+
+    return snapshot.prefix_index.find(prefix);
+}
+
+template <typename T>
+void ReadConfig::bind_value(const ConfigSnapshot &snapshot, const ConfigKey &key, T *destination,
+                            BindSummary &summary) const
+{
+    const Stored<T> *value = nullptr;
+    Lookup result = this->lookup(snapshot, key, value);
+
+    if (result == Lookup::Found)
+    {
+        *destination = *value;
+        summary.found++;
+    }
+    else if (result == Lookup::Invalid)
+    {
+        summary.errors.push_back(BindError{std::string(key.name()), invalid_reason(destination)});
+    }
+    else
+    {
+        summary.missing.emplace_back(key.name());
+    }
+}
+
+template <typename T>
+void ReadConfig::bind_value(const ConfigSnapshot &snapshot, const ConfigKey &key, ConfigBinding::Array<T> destination,
+                            BindSummary &summary) const
+{
+    const Stored<std::vector<T>> *values = nullptr;
+    Lookup result = this->lookup(snapshot, key, values);
+
+    if (result == Lookup::Found && values->size() != static_cast<std::size_t>(destination.size))
+    {
+        summary.errors.push_back(BindError{std::string(key.name()), "The array in the file has " +
+                                           std::to_string(values->size()) + " fields, but " +
+                                           std::to_string(destination.size) + " were requested."});
+    }
+    else if (result == Lookup::Found)
+    {
+        std::copy(values->begin(), values->end(), destination.values);
+        summary.found++;
+    }
+    else if (result == Lookup::Invalid)
+    {
+        summary.errors.push_back(BindError{std::string(key.name()), "Field " +
+                                           std::to_string(invalid_field<T>(snapshot, key)) +
+                                           invalid_field_reason(destination.values)});
+    }
+    else
+    {
+        summary.missing.emplace_back(key.name());
+    }
+}
+
+
+// The functions with a runtime name hash it once and read through the key.
+
+void ReadConfig::get_parameter(std::string int_value_name, int &int_value) const
+{
+    this->get_parameter(ConfigKey(int_value_name), int_value);
+}
+
+void ReadConfig::get_parameter(std::string char_value_name, char &char_value) const
+{
+    this->get_parameter(ConfigKey(char_value_name), char_value);
+}
+
+void ReadConfig::get_parameter(std::string float_value_name, float &float_value) const
+{
+    this->get_parameter(ConfigKey(float_value_name), float_value);
+}
+
+void ReadConfig::get_parameter(std::string str_value_name, std::string &str_value) const
+{
+    this->get_parameter(ConfigKey(str_value_name), str_value);
+}
+
+void ReadConfig::get_parameter(std::string bool_value_name, bool &bool_value) const
+{
+    this->get_parameter(ConfigKey(bool_value_name), bool_value);
+}
+
+void ReadConfig::get_parameter(std::string int_arr_value_name, int *int_arr_value, int int_arr_size) const
+{
+    this->get_parameter(ConfigKey(int_arr_value_name), int_arr_value, int_arr_size);
+}
+
+void ReadConfig::get_parameter(std::string float_arr_value_name, float *float_arr_value, int float_arr_size) const
+{
+    this->get_parameter(ConfigKey(float_arr_value_name), float_arr_value, float_arr_size);
+}
+
+void ReadConfig::get_parameter(std::string char_arr_value_name, char *char_arr_value, int char_arr_size) const
+{
+    this->get_parameter(ConfigKey(char_arr_value_name), char_arr_value, char_arr_size);
+}
+
+void ReadConfig::get_parameter(std::string str_arr_value_name, std::string *str_array_value, int str_arr_size) const
+{
+    this->get_parameter(ConfigKey(str_arr_value_name), str_array_value, str_arr_size);
+}
+
+void ReadConfig::get_parameter(std::string int_arr_value_name, std::vector<int> &int_arr_values) const
+{
+    this->get_parameter(ConfigKey(int_arr_value_name), int_arr_values);
+}
+
+void ReadConfig::get_parameter(std::string float_arr_value_name, std::vector<float> &float_arr_values) const
+{
+    this->get_parameter(ConfigKey(float_arr_value_name), float_arr_values);
+}
+
+void ReadConfig::get_parameter(std::string char_arr_value_name, std::vector<char> &char_arr_values) const
+{
+    this->get_parameter(ConfigKey(char_arr_value_name), char_arr_values);
+}
+
+void ReadConfig::get_parameter(std::string str_arr_value_name, std::vector<std::string> &str_arr_values) const
+{
+    this->get_parameter(ConfigKey(str_arr_value_name), str_arr_values);
+}
+
+int ReadConfig::get_array(std::string int_arr_value_name, int *int_arr_value, int capacity) const
+{
+    return this->get_array(ConfigKey(int_arr_value_name), int_arr_value, capacity);
+}
+
+int ReadConfig::get_array(std::string float_arr_value_name, float *float_arr_value, int capacity) const
+{
+    return this->get_array(ConfigKey(float_arr_value_name), float_arr_value, capacity);
+}
+
+int ReadConfig::get_array(std::string char_arr_value_name, char *char_arr_value, int capacity) const
+{
+    return this->get_array(ConfigKey(char_arr_value_name), char_arr_value, capacity);
+}
+
+int ReadConfig::get_array(std::string str_arr_value_name, std::string *str_array_value, int capacity) const
+{
+    return this->get_array(ConfigKey(str_arr_value_name), str_array_value, capacity);
+}
 
 }
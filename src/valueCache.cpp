@@ -0,0 +1,90 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    valueCache.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Cache of the converted values of a snapshot, which can be filled by several threads at once.
+ *
+ * New conversions are pushed in front of the list of an entry with a compare and swap. Nothing is freed here, the
+ * arena of the snapshot gives back all lists and values at once.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <cstring>
+#include <new>
+
+#include "valueCache.hpp"
+
+
+namespace SPFR
+{
+
+void ValueCache::resize(std::size_t count)
+{
+    // The lists of the previous size stay in the arena until it is freed.
+    this->chunks = nullptr;
+    this->count = 0;
+
+    if (count == 0) return;
+
+    std::size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+
+    // Zeroed memory holds chunks which weren't read yet.
+    void *memory = this->resource->allocate(chunk_count * sizeof(std::atomic<Heads *>), alignof(std::atomic<Heads *>));
+
+    std::memset(memory, 0, chunk_count * sizeof(std::atomic<Heads *>));
+
+    this->chunks = static_cast<std::atomic<Heads *> *>(memory);
+    this->count = count;
+}
+
+const TypedValue *ValueCache::insert_value(std::size_t entry, TypedValue value) const
+{
+    std::atomic<Heads *> &chunk = this->chunks[entry / chunk_size];
+    Heads *heads = chunk.load(std::memory_order_acquire);
+
+    if (heads == nullptr)
+    {
+        // Zeroed memory holds empty lists. If another thread added the chunk first, its chunk is used.
+        void *memory = this->values.allocate(chunk_size * sizeof(Heads), alignof(Heads));
+
+        std::memset(memory, 0, chunk_size * sizeof(Heads));
+
+        Heads *fresh = static_cast<Heads *>(memory);
+
+        heads = chunk.compare_exchange_strong(heads, fresh, std::memory_order_acq_rel, std::memory_order_acquire)
+              ? fresh : heads;
+    }
+
+    Node *node = new (this->values.allocate(sizeof(Node), alignof(Node))) Node{std::move(value), nullptr};
+    Heads &list = heads[entry % chunk_size];
+    const Node *head = list.load(std::memory_order_acquire);
+
+    for (;;)
+    {
+        // Two threads may convert the same entry at the same time. The first one wins, the other one uses its value.
+        for (const Node *other = head; other != nullptr; other = other->next)
+        {
+            if (other->value.index() == node->value.index())
+            {
+                node->~Node();
+                this->values.deallocate(node, sizeof(Node), alignof(Node));
+                return &other->value;
+            }
+        }
+
+        node->next = head;
+
+        if (list.compare_exchange_weak(head, node, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return &node->value;
+        }
+    }
+}
+
+}
@@ -0,0 +1,304 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    valueConversion.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Conversion of the values of a configuration file into the supported data types.
+ *
+ * Every get_parameter overload uses these functions, the results are cached by the ReadConfig class. Numbers are read
+ * with std::from_chars, which neither depends on the locale nor throws, and arrays are read field by field straight
+ * from the text of the value.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "valueConversion.hpp"
+
+
+namespace SPFR
+{
+namespace
+{
+
+// Characters which are skipped in the fields of an array: spaces and the brackets around the array.
+inline bool is_ignored(char c)
+{
+    return c == ' ' || c == '(' || c == ')' || c == '[' || c == ']' || c == '{' || c == '}';
+}
+
+std::string_view trim(std::string_view field)
+{
+    while (!field.empty() && is_ignored(field.front())) field.remove_prefix(1);
+    while (!field.empty() && is_ignored(field.back())) field.remove_suffix(1);
+
+    return field;
+}
+
+// Calls "handle" for every comma separated field of an array and stops at the first field it rejects. Fields which
+// are empty after removing spaces and brackets are skipped.
+template <typename Handle>
+bool for_each_field(std::string_view text, Handle handle)
+{
+    const char *p = text.data();
+    const char *end = p + text.size();
+
+    while (p < end)
+    {
+        const char *comma = static_cast<const char *>(std::memchr(p, ',', static_cast<std::size_t>(end - p)));
+        const char *field_end = comma != nullptr ? comma : end;
+        std::string_view field = trim(std::string_view(p, static_cast<std::size_t>(field_end - p)));
+
+        if (!field.empty() && !handle(field)) return false;
+
+        p = field_end + 1;
+    }
+
+    return true;
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+/**
+ *  Reads an integer with less than eight digits with a few word operations instead of one step per digit. The eight
+ *  bytes from the first digit on have to be readable, so the fast path is only taken in front of "readable_end".
+ *  Returns false if the field doesn't fit the fast path and has to be read by std::from_chars.
+ */
+inline bool parse_short_integer(std::string_view field, const char *readable_end, int &value)
+{
+    const char *p = field.data();
+    const char *field_end = p + field.size();
+    bool negative = (*p == '-');
+
+    if (negative) p++;
+
+    if (readable_end - p < 8) return false;
+
+    std::uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+
+    // Turn the digits into the values 0 to 9. Every other byte gets its highest bit set, either directly or by adding
+    // 0x76, so the lowest set bit marks the end of the digits. Carries only run from a non-digit to the bytes behind.
+    std::uint64_t digits = word ^ 0x3030303030303030ull;
+    std::uint64_t non_digits = ((digits + 0x7676767676767676ull) | digits) & 0x8080808080808080ull;
+
+    if (non_digits == 0) return false;
+
+    unsigned count = static_cast<unsigned>(__builtin_ctzll(non_digits)) / 8;
+
+    if (count == 0 || p + count != field_end) return false;
+
+    // Move the digits to the end of the word, so the free bytes in front of them are leading zeros, and combine
+    // pairs, quadruples and octets of digits.
+    digits <<= 8 * (8 - count);
+    digits = (digits * 10) + (digits >> 8);
+    digits = (((digits & 0x000000FF000000FFull) * 0x000F424000000064ull) +
+              (((digits >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32;
+
+    value = negative ? -static_cast<int>(digits) : static_cast<int>(digits);
+
+    return true;
+}
+#else
+inline bool parse_short_integer(std::string_view, const char *, int &)
+{
+    return false;
+}
+#endif
+
+template <typename T>
+bool parse_number(std::string_view text, T &value)
+{
+    const char *begin = text.data();
+    const char *end = begin + text.size();
+
+    // std::from_chars doesn't accept a leading plus sign.
+    if (begin < end && *begin == '+') begin++;
+
+    if (begin == end || *begin == '+' || (*begin == '-' && begin != text.data())) return false;
+
+    std::from_chars_result result = std::from_chars(begin, end, value);
+
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+template <typename Vector>
+bool parse_number_array(std::string_view text, Vector &values)
+{
+    using T = typename Vector::value_type;
+
+    const char *readable_end = text.data() + text.size();
+
+    values.clear();
+
+    // A first guess of the number of fields, so big arrays don't grow step by step.
+    values.reserve(text.size() / 4 + 1);
+
+    return for_each_field(text, [&values, readable_end](std::string_view field)
+    {
+        T value;
+
+        if constexpr (std::is_same<T, int>::value)
+        {
+            if (parse_short_integer(field, readable_end, value))
+            {
+                values.push_back(value);
+
+                return true;
+            }
+        }
+
+        if (!parse_number(field, value)) return false;
+
+        values.push_back(value);
+
+        return true;
+    });
+}
+
+template <typename String>
+bool parse_string(std::string_view text, String &value)
+{
+    value.clear();
+    value.reserve(text.size());
+
+    // Only arrays of a memory mapped file keep their spaces.
+    for (char c : text)
+    {
+        if (c != ' ') value += c;
+    }
+
+    return true;
+}
+
+template <typename Vector>
+bool parse_char_array(std::string_view text, Vector &values)
+{
+    values.clear();
+
+    return for_each_field(text, [&values](std::string_view field)
+    {
+        if (field.size() != 1) return false;
+
+        values.push_back(field[0]);
+
+        return true;
+    });
+}
+
+template <typename Vector>
+bool parse_string_array(std::string_view text, Vector &values)
+{
+    values.clear();
+
+    return for_each_field(text, [&values](std::string_view field)
+    {
+        // The strings of a std::pmr vector get the memory resource of the vector.
+        auto &value = values.emplace_back();
+
+        for (char c : field)
+        {
+            if (!is_ignored(c)) value += c;
+        }
+
+        return true;
+    });
+}
+
+}
+
+bool parse_value(std::string_view text, int &value)
+{
+    return parse_number(text, value);
+}
+
+bool parse_value(std::string_view text, float &value)
+{
+    return parse_number(text, value);
+}
+
+bool parse_value(std::string_view text, bool &value)
+{
+    if (text == "1" || text == "true" || text == "TRUE")
+    {
+        value = true;
+
+        return true;
+    }
+    else if (text == "0" || text == "false" || text == "FALSE")
+    {
+        value = false;
+
+        return true;
+    }
+
+    return false;
+}
+
+bool parse_value(std::string_view text, char &value)
+{
+    if (text.length() != 1) return false;
+
+    value = text[0];
+
+    return true;
+}
+
+bool parse_value(std::string_view text, std::string &value)
+{
+    return parse_string(text, value);
+}
+
+bool parse_value(std::string_view text, std::vector<int> &values)
+{
+    return parse_number_array(text, values);
+}
+
+bool parse_value(std::string_view text, std::vector<float> &values)
+{
+    return parse_number_array(text, values);
+}
+
+bool parse_value(std::string_view text, std::vector<char> &values)
+{
+    return parse_char_array(text, values);
+}
+
+bool parse_value(std::string_view text, std::vector<std::string> &values)
+{
+    return parse_string_array(text, values);
+}
+
+bool parse_value(std::string_view text, std::pmr::string &value)
+{
+    return parse_string(text, value);
+}
+
+bool parse_value(std::string_view text, std::pmr::vector<int> &values)
+{
+    return parse_number_array(text, values);
+}
+
+bool parse_value(std::string_view text, std::pmr::vector<float> &values)
+{
+    return parse_number_array(text, values);
+}
+
+bool parse_value(std::string_view text, std::pmr::vector<char> &values)
+{
+    return parse_char_array(text, values);
+}
+
+bool parse_value(std::string_view text, std::pmr::vector<std::pmr::string> &values)
+{
+    return parse_string_array(text, values);
+}
+
+}
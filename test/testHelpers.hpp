@@ -0,0 +1,125 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    testHelpers.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Checks and files for the tests, which CTest runs.
+ *
+ * A test counts its failed checks and returns a non-zero exit code if one failed, so it needs no test framework.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_TEST_HELPERS_HPP_AP_17102026
+#define HEADER_TEST_HELPERS_HPP_AP_17102026
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "readConfig.hpp"
+
+
+namespace SPFR_TEST
+{
+inline std::atomic<int> &failures()
+{
+    static std::atomic<int> count{0};
+
+    return count;
+}
+
+inline bool check(bool condition, const char *text, const char *file, int line)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "%s:%d: Check failed: %s\n", file, line, text);
+        failures()++;
+    }
+
+    return condition;
+}
+
+#define SPFR_CHECK(condition) SPFR_TEST::check((condition), #condition, __FILE__, __LINE__)
+
+/** Prints the result of the test. @return The exit code of the test. */
+inline int finish(const char *test_name)
+{
+    std::printf("%s: %d failed checks\n", test_name, failures().load());
+
+    return failures() == 0 ? 0 : 1;
+}
+
+/** Writes the file in place, so a reader of the file can see it while it is written. */
+inline void write_file(const std::string &file_name, const std::string &text)
+{
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+
+    file << text;
+}
+
+/** Writes the file next to its name and renames it, so a reader sees either the old or the new file. */
+inline void replace_file(const std::string &file_name, const std::string &text)
+{
+    write_file(file_name + ".tmp", text);
+    std::rename((file_name + ".tmp").c_str(), file_name.c_str());
+}
+
+/** Silent options, so the tests only print their failures. */
+inline SPFR::ReadOptions silent_options(SPFR::LoadMode load_mode = SPFR::LoadMode::Buffered)
+{
+    SPFR::ReadOptions options;
+
+    options.load_mode = load_mode;
+    options.log_mode = SPFR::LogMode::Silent;
+
+    return options;
+}
+
+template <typename T>
+void check_same(const SPFR::ReadConfig &expected, const SPFR::ReadConfig &actual, const std::string &name,
+                const T &initial)
+{
+    T expected_value = initial;
+    T actual_value = initial;
+
+    expected.get_parameter(name, expected_value);
+    actual.get_parameter(name, actual_value);
+
+    if (!SPFR_CHECK(expected_value == actual_value)) std::fprintf(stderr, "    Parameter: %s\n", name.c_str());
+}
+
+/** Checks that both readers have the same names and return the same value of every name for every type. */
+inline void check_same_parameters(const SPFR::ReadConfig &expected, const SPFR::ReadConfig &actual)
+{
+    std::vector<std::string> names = expected.get_keys("");
+    std::vector<std::string> actual_names = actual.get_keys("");
+
+    std::sort(names.begin(), names.end());
+    std::sort(actual_names.begin(), actual_names.end());
+    SPFR_CHECK(names == actual_names);
+
+    for (const std::string &name : names)
+    {
+        check_same(expected, actual, name, -12345);
+        check_same(expected, actual, name, -1.5f);
+        check_same(expected, actual, name, false);
+        check_same(expected, actual, name, true);
+        check_same(expected, actual, name, '~');
+        check_same(expected, actual, name, std::string("initial"));
+        check_same(expected, actual, name, std::vector<int>{-1});
+        check_same(expected, actual, name, std::vector<float>{-1.5f});
+        check_same(expected, actual, name, std::vector<char>{'~'});
+        check_same(expected, actual, name, std::vector<std::string>{"initial"});
+    }
+}
+}
+
+#endif // HEADER_TEST_HELPERS_HPP_AP_17102026
@@ -0,0 +1,99 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    testImage.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Compares the values of a compiled image with the ones of its text file.
+ *
+ * The compiler converts every value in advance and resolves the includes, the compiled reader has to return exactly
+ * what the text reader returns, for every parameter and every type.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <string>
+
+#include "cmake_config.h"
+#include "configImage.hpp"
+#include "testHelpers.hpp"
+
+
+namespace
+{
+void check_image(const std::string &config_file_name)
+{
+    const std::string image_file_name = "test_image.image";
+    std::string error;
+
+    if (!SPFR_CHECK(SPFR::ConfigImage::compile(config_file_name, image_file_name, error)))
+    {
+        std::fprintf(stderr, "    %s\n", error.c_str());
+        return;
+    }
+
+    SPFR::ReadConfig text(config_file_name, SPFR_TEST::silent_options());
+    SPFR::ReadConfig image(image_file_name, SPFR_TEST::silent_options(SPFR::LoadMode::Compiled));
+
+    SPFR_CHECK(!text.get_keys("").empty());
+    SPFR_TEST::check_same_parameters(text, image);
+}
+
+// Values of every type, invalid ones, duplicates and includes, which the file overrides.
+void test_includes()
+{
+    SPFR_TEST::write_file("test_image_base.config",
+                          "base_int: 1\n"
+                          "shared: from_base\n"
+                          "base_array: [1.5, -2, 3e2]\n");
+
+    SPFR_TEST::write_file("test_image_site.config",
+                          "@include: test_image_base.config\n"
+                          "site_bool: TRUE\n"
+                          "shared: from_site\n");
+
+    SPFR_TEST::write_file("test_image.config",
+                          "shared: from_file    # Wins over both includes.\n"
+                          "@include: test_image_site.config\n"
+                          "int: -42\n"
+                          "float: 3.25\n"
+                          "exponent: 1e-3\n"
+                          "too_big: 99999999999999999999\n"
+                          "bool_word: false\n"
+                          "bool_number: 1\n"
+                          "char: x\n"
+                          "path: /srv/a b/c.bin\n"
+                          "ints: [1, 2, 3]\n"
+                          "mixed: [1, two, 3.5]\n"
+                          "strings: [a b, c, d]\n"
+                          "chars: [a, b, c]\n"
+                          "empty_array: []\n"
+                          "unclosed: [1, 2\n"
+                          "int: 7\n");
+
+    check_image("test_image.config");
+}
+
+// A name without a value shifts the following values in the text reader, the compiler refuses the file.
+void test_missing_value()
+{
+    std::string error;
+
+    SPFR_TEST::write_file("test_image_broken.config", "int: 1\nno_value\n");
+
+    SPFR_CHECK(!SPFR::ConfigImage::compile("test_image_broken.config", "test_image_broken.image", error));
+    SPFR_CHECK(error.find("without a value") != std::string::npos);
+}
+}
+
+int main()
+{
+    check_image(std::string(CONFIG_DIRECTORY) + "/test.config");
+    test_includes();
+    test_missing_value();
+
+    return SPFR_TEST::finish("testImage");
+}
@@ -0,0 +1,130 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    testIncremental.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Compares the incremental reload of an edited file with a full load of it.
+ *
+ * The file is edited like by a user, at the start, in the middle and at the end. After every edit the reader with
+ * the incremental reload, which takes over the tokens of the unchanged blocks, has to return the same as a new reader.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "testHelpers.hpp"
+
+
+namespace
+{
+using Lines = std::vector<std::string>;
+
+Lines config_lines()
+{
+    Lines lines;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        std::string number = std::to_string(i);
+
+        switch (i % 5)
+        {
+            case 0:  lines.push_back("int_" + number + ": " + number); break;
+            case 1:  lines.push_back("float_" + number + ": " + number + ".5    # Comment"); break;
+            case 2:  lines.push_back("array_" + number + ": [" + number + ", 1, 2]"); break;
+            case 3:  lines.push_back("# Comment " + number); break;
+            default: lines.push_back("path_" + number + ": /srv/set_" + number + "/a b.bin"); break;
+        }
+    }
+
+    return lines;
+}
+
+std::string text_of(const Lines &lines)
+{
+    std::string text;
+
+    for (const std::string &line : lines) text += line + "\n";
+
+    return text;
+}
+
+struct Edit
+{
+    const char *name;
+    std::function<void(Lines &)> apply;
+};
+
+void test_edits(SPFR::LoadMode load_mode)
+{
+    const std::string file_name = "test_incremental.config";
+    const std::vector<Edit> edits =
+    {
+        {"change a value", [](Lines &lines) { lines[2500] = "int_2500: -1"; }},
+        {"insert lines", [](Lines &lines) { lines.insert(lines.begin() + 1200, {"new_1: 1", "new_2: [1, 2]", ""}); }},
+        {"delete lines", [](Lines &lines) { lines.erase(lines.begin() + 3000, lines.begin() + 3100); }},
+        {"prepend a line", [](Lines &lines) { lines.insert(lines.begin(), "first: 1"); }},
+        {"append a line", [](Lines &lines) { lines.push_back("last: 2"); }},
+        {"add a duplicate", [](Lines &lines) { lines.insert(lines.begin() + 10, "int_4000: 7"); }},
+        {"remove the first", [](Lines &lines) { lines.erase(lines.begin() + 10); }},
+        {"break a line", [](Lines &lines) { lines[4000] = "float_4001"; }},
+        {"empty the file", [](Lines &lines) { lines.clear(); }},
+        {"fill it again", [](Lines &lines) { lines = config_lines(); }},
+    };
+
+    Lines lines = config_lines();
+
+    SPFR_TEST::replace_file(file_name, text_of(lines));
+
+    SPFR::ReadOptions options = SPFR_TEST::silent_options(load_mode);
+    SPFR::ReadOptions incremental_options = options;
+
+    incremental_options.incremental_reload = true;
+    incremental_options.log_mode = SPFR::LogMode::Buffered;
+    incremental_options.log_level = SPFR::Severity::Info;
+
+    SPFR::ReadConfig incremental(file_name, incremental_options);
+
+    for (const Edit &edit : edits)
+    {
+        int failures = SPFR_TEST::failures();
+
+        edit.apply(lines);
+        SPFR_TEST::replace_file(file_name, text_of(lines));
+
+        incremental.clear_log();
+        incremental.reload();
+
+        // The reload took over the blocks of the previous version instead of tokenizing the whole file.
+        bool blocks_kept = false;
+
+        for (const SPFR::LogRecord &record : incremental.get_log())
+        {
+            blocks_kept = blocks_kept || record.message.find("the other blocks are unchanged") != std::string::npos;
+        }
+
+        SPFR_CHECK(blocks_kept);
+
+        SPFR::ReadConfig full(file_name, options);
+
+        SPFR_TEST::check_same_parameters(full, incremental);
+
+        if (SPFR_TEST::failures() != failures) std::fprintf(stderr, "    Edit: %s\n", edit.name);
+    }
+}
+}
+
+int main()
+{
+    test_edits(SPFR::LoadMode::Buffered);
+    test_edits(SPFR::LoadMode::MemoryMapped);
+
+    return SPFR_TEST::finish("testIncremental");
+}
@@ -0,0 +1,242 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    testReload.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Reads parameters on several threads while the configuration is reloaded.
+ *
+ * Every version of the file has the same number in all of its values. A read which mixed two versions would see two
+ * different numbers, a reader which went back to an older version would see a smaller one.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testHelpers.hpp"
+
+
+namespace
+{
+constexpr int array_size = 32;
+constexpr int reader_count = 3;
+constexpr int version_count = 40;
+
+// The filler lines make every version a different size, so a mapping of an older version would be too short or long.
+std::string config_text(int version)
+{
+    std::string text = "version: " + std::to_string(version) + "\nname: version_" + std::to_string(version) +
+                       "\nnumbers: [";
+
+    for (int i = 0; i < array_size; i++) text += (i == 0 ? "" : ", ") + std::to_string(version);
+
+    text += "]\n";
+
+    for (int i = 0; i < (version % 2 == 0 ? 2000 : 20); i++)
+    {
+        text += "filler_" + std::to_string(i) + ": " + std::to_string(version) + "    # Comment\n";
+    }
+
+    return text;
+}
+
+void read_versions(const SPFR::ReadConfig &config, const std::atomic<bool> &stop)
+{
+    int last_version = 0;
+    int version = 0;
+    std::string name;
+    int numbers[array_size];
+    SPFR::ConfigBinding binding;
+
+    binding.bind("version", version);
+    binding.bind("name", name);
+    binding.bind("numbers", numbers, array_size);
+
+    while (!stop.load())
+    {
+        // All parameters of one resolve() come from the same snapshot.
+        SPFR::BindSummary summary = config.resolve(binding);
+
+        if (SPFR_CHECK(summary.found == 3 && summary.missing.empty() && summary.errors.empty()))
+        {
+            SPFR_CHECK(name == "version_" + std::to_string(version));
+            SPFR_CHECK(version >= last_version);
+
+            for (int number : numbers) SPFR_CHECK(number == version);
+
+            last_version = version;
+        }
+
+        // A single read converts its value from one snapshot as well.
+        std::vector<int> values;
+
+        config.get_parameter("numbers", values);
+
+        if (SPFR_CHECK(values.size() == array_size))
+        {
+            for (int value : values) SPFR_CHECK(value == values[0]);
+        }
+    }
+}
+
+// Calls reload() after the file was replaced by a rename.
+void test_reload(SPFR::LoadMode load_mode)
+{
+    const std::string file_name = "test_reload.config";
+
+    SPFR_TEST::replace_file(file_name, config_text(1));
+
+    SPFR::ReadConfig config(file_name, SPFR_TEST::silent_options(load_mode));
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < reader_count; i++) readers.emplace_back(read_versions, std::cref(config), std::cref(stop));
+
+    for (int version = 2; version <= version_count; version++)
+    {
+        std::uint64_t old_version = config.get_version();
+
+        SPFR_TEST::replace_file(file_name, config_text(version));
+        SPFR_CHECK(config.reload());
+        SPFR_CHECK(config.get_version() > old_version);
+    }
+
+    stop = true;
+
+    for (std::thread &reader : readers) reader.join();
+
+    int version = 0;
+
+    config.get_parameter("version", version);
+    SPFR_CHECK(version == version_count);
+}
+
+// With the hot reload the file is rewritten in place and the watcher reloads it.
+void test_hot_reload(SPFR::LoadMode load_mode)
+{
+    const std::string file_name = "test_hot_reload.config";
+
+    SPFR_TEST::write_file(file_name, config_text(1));
+
+    SPFR::ReadOptions options = SPFR_TEST::silent_options(load_mode);
+
+    options.hot_reload = true;
+
+    SPFR::ReadConfig config(file_name, options);
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < reader_count; i++) readers.emplace_back(read_versions, std::cref(config), std::cref(stop));
+
+    for (int version = 2; version <= version_count; version++)
+    {
+        std::uint64_t old_version = config.get_version();
+
+        SPFR_TEST::write_file(file_name, config_text(version));
+
+        // The next version is only written after the reload, which would otherwise read a half written file.
+        std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+        while (config.get_version() == old_version && std::chrono::steady_clock::now() < timeout)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        SPFR_CHECK(config.get_version() > old_version);
+    }
+
+    stop = true;
+
+    for (std::thread &reader : readers) reader.join();
+
+    int version = 0;
+
+    config.get_parameter("version", version);
+    SPFR_CHECK(version == version_count);
+}
+
+// The file is deleted right after it was replaced, while the watcher reloads it. The reader keeps a complete version,
+// until the file is written again.
+void test_deleted_file(SPFR::LoadMode load_mode)
+{
+    const std::string file_name = "test_deleted.config";
+
+    SPFR_TEST::write_file(file_name, config_text(1));
+
+    SPFR::ReadOptions options = SPFR_TEST::silent_options(load_mode);
+
+    options.hot_reload = true;
+
+    SPFR::ReadConfig config(file_name, options);
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < reader_count; i++) readers.emplace_back(read_versions, std::cref(config), std::cref(stop));
+
+    for (int version = 2; version < version_count; version++)
+    {
+        SPFR_TEST::replace_file(file_name, config_text(version));
+        std::remove(file_name.c_str());
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    SPFR_TEST::write_file(file_name, config_text(version_count));
+
+    int version = 0;
+    std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (version != version_count && std::chrono::steady_clock::now() < timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        config.get_parameter("version", version);
+    }
+
+    stop = true;
+
+    for (std::thread &reader : readers) reader.join();
+
+    SPFR_CHECK(version == version_count);
+}
+
+// A watcher which couldn't be started reports its error once, not again with every reload.
+void test_failed_watcher()
+{
+    SPFR::ReadOptions options = SPFR_TEST::silent_options();
+
+    options.hot_reload = true;
+    options.log_mode = SPFR::LogMode::Buffered;
+
+    SPFR::ReadConfig config("missing_directory/test.config", options);
+
+    config.clear_log();
+    config.reload();
+
+    for (const SPFR::LogRecord &record : config.get_log())
+    {
+        SPFR_CHECK(record.message.find("Error while watching") == std::string::npos);
+    }
+}
+}
+
+int main()
+{
+    test_reload(SPFR::LoadMode::Buffered);
+    test_reload(SPFR::LoadMode::MemoryMapped);
+    test_hot_reload(SPFR::LoadMode::Buffered);
+    test_hot_reload(SPFR::LoadMode::MemoryMapped);
+    test_deleted_file(SPFR::LoadMode::Buffered);
+    test_deleted_file(SPFR::LoadMode::MemoryMapped);
+    test_failed_watcher();
+
+    return SPFR_TEST::finish("testReload");
+}
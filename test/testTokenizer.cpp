@@ -0,0 +1,145 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    testTokenizer.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Compares the tokens of the tokenizer on several threads with the ones of one thread.
+ *
+ * The text has every kind of line the tokenizer knows and is big enough for several chunks of 1 MB, so the chunk
+ * bounds fall into all kinds of lines.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "configTokenizer.hpp"
+#include "testHelpers.hpp"
+
+
+namespace
+{
+using Tokens = std::pmr::vector<std::string_view>;
+using Spill = std::pmr::deque<std::pmr::string>;
+using Spills = std::pmr::vector<Spill>;
+
+const unsigned thread_counts[] = {2, 3, 4, 8};
+
+std::string config_text()
+{
+    std::string text;
+
+    for (int i = 0; text.size() < 6 * 1048576; i++)
+    {
+        std::string number = std::to_string(i);
+
+        switch (i % 12)
+        {
+            case 0:  text += "int_" + number + ": " + number + "\n"; break;
+            case 1:  text += "float_" + number + ":-" + number + ".25    # Comment behind the value.\n"; break;
+            case 2:  text += "array_" + number + ": [" + number + ", 2, 3,   4]\n"; break;
+            case 3:  text += "# A comment line: with a colon.\n"; break;
+            case 4:  text += "\n"; break;
+            case 5:  text += "   spaces_" + number + "   :   a value with spaces   \n"; break;
+            case 6:  text += "several_" + number + ": parts: in: one line\n"; break;
+            case 7:  text += "no_value_" + number + ":\n"; break;
+            case 8:  text += "strings_" + number + ": [a b, c , d]\r\n"; break;
+            case 9:  text += "   \t  \n"; break;
+            case 10: text += "long_" + number + ": " + std::string(100 + i % 3000, 'x') + "\n"; break;
+            default: text += "path_" + number + ": /srv/data/set_" + number + "/file.bin\n"; break;
+        }
+    }
+
+    // The last line has no line end.
+    return text + "last: 1";
+}
+
+void test_writable(const std::string &text)
+{
+    std::string buffer = text;
+    Tokens expected;
+
+    SPFR::tokenize_config(&buffer[0], buffer.size(), expected);
+    SPFR_CHECK(expected.size() > 50000);
+
+    for (unsigned thread_count : thread_counts)
+    {
+        std::string chunked_buffer = text;
+        Tokens tokens;
+
+        SPFR::tokenize_config(&chunked_buffer[0], chunked_buffer.size(), tokens, thread_count);
+        SPFR_CHECK(tokens == expected);
+    }
+}
+
+void test_read_only(const std::string &text)
+{
+    Tokens expected;
+    Spill spill;
+
+    SPFR::tokenize_config(text.data(), text.size(), expected, spill);
+
+    for (unsigned thread_count : thread_counts)
+    {
+        Tokens tokens;
+        Spills spills;
+
+        SPFR::tokenize_config(text.data(), text.size(), tokens, spills, thread_count);
+        SPFR_CHECK(tokens == expected);
+    }
+}
+
+void test_lazy(const std::string &text)
+{
+    Tokens expected;
+    Spill spill;
+
+    SPFR::tokenize_config_lazy(text.data(), text.size(), expected, spill);
+
+    for (unsigned thread_count : thread_counts)
+    {
+        Tokens tokens;
+        Spills spills;
+
+        SPFR::tokenize_config_lazy(text.data(), text.size(), tokens, spills, thread_count);
+        SPFR_CHECK(tokens == expected);
+    }
+}
+
+// The reader on several threads has the same parameters as the one on one thread.
+void test_reader(const std::string &text)
+{
+    const std::string file_name = "test_tokenizer.config";
+
+    SPFR_TEST::write_file(file_name, text);
+
+    SPFR::ReadOptions options = SPFR_TEST::silent_options(SPFR::LoadMode::MemoryMapped);
+    SPFR::ReadConfig expected(file_name, options);
+
+    options.parse_threads = 4;
+
+    SPFR::ReadConfig actual(file_name, options);
+
+    SPFR_TEST::check_same_parameters(expected, actual);
+}
+}
+
+int main()
+{
+    std::string text = config_text();
+
+    test_writable(text);
+    test_read_only(text);
+    test_lazy(text);
+    test_reader(text);
+
+    return SPFR_TEST::finish("testTokenizer");
+}
@@ -0,0 +1,71 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    compile.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Compiles a configuration file into a binary image.
+ *
+ * Usage: SPFR_compile CONFIG_FILE IMAGE_FILE
+ *        SPFR_compile CONFIG_FILE --shared SHARED_NAME
+ *
+ * The image is read with LoadMode::Compiled. It has to be compiled again after every change of the configuration
+ * file and on every machine with another byte order. With --shared the image is published in shared memory under a
+ * name like "/spfr_motor" and read with LoadMode::Shared.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "configImage.hpp"
+
+
+int main (int argc, char *argv[])
+{
+    bool shared = argc == 4 && std::string(argv[2]) == "--shared";
+
+    if (argc != 3 && !shared)
+    {
+        std::fprintf(stderr, "Usage: %s CONFIG_FILE IMAGE_FILE\n       %s CONFIG_FILE --shared SHARED_NAME\n",
+                     argv[0], argv[0]);
+        return 2;
+    }
+
+    std::string error;
+    std::string image_name = shared ? argv[3] : argv[2];
+    bool compiled = shared ? SPFR::ConfigImage::publish(argv[1], image_name, error)
+                           : SPFR::ConfigImage::compile(argv[1], image_name, error);
+
+    if (!compiled)
+    {
+        std::fprintf(stderr, "Error while compiling %s: %s\n", argv[1], error.c_str());
+        return 1;
+    }
+
+    // Open the image like the reader does, so a broken image is noticed here and not at the start of the program.
+    SPFR::ConfigImage image;
+
+    if (!image.open(shared ? SPFR::ConfigImage::shared_path(image_name) : image_name, error))
+    {
+        std::fprintf(stderr, "Error while checking %s: %s\n", image_name.c_str(), error.c_str());
+        return 1;
+    }
+
+    if (shared)
+    {
+        std::printf("Published %u parameters of %s as %s, generation %ju.\n", image.size(), argv[1],
+                    image_name.c_str(), static_cast<std::uintmax_t>(image.generation()));
+    }
+    else
+    {
+        std::printf("Compiled %u parameters of %s into %s.\n", image.size(), argv[1], image_name.c_str());
+    }
+
+    return 0;
+}
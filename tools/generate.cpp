@@ -0,0 +1,524 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * SPFR - Simple Parameter File Reader
+ *
+ * @file    generate.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.1
+ * @date    2026-10-17
+ *
+ * @brief   Generates a struct with typed fields and its own parser from a configuration template.
+ *
+ * Usage: SPFR_generate TEMPLATE_FILE STRUCT_NAME HEADER_FILE
+ *
+ * The template is a configuration file with one parameter per line. Its values become the initial values of the
+ * fields. The type of a field is taken from the value, or from an annotation in the comment of the line or of the
+ * comment line before it, with the type names of a schema:
+ *
+ *      number_bool: 1      # @type bool
+ *
+ * The parser of the struct switches on the length of a name and compares it only to the names of the same length,
+ * or switches on the hash of the name if there are more of them. The value is converted directly into its field.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "configSchema.hpp"
+#include "configStruct.hpp"
+#include "configTokenizer.hpp"
+
+
+namespace
+{
+
+// Names with up to this many names of the same length are compared one after another, more get a switch on the hash.
+constexpr std::size_t max_compares = 4;
+
+struct Parameter
+{
+    std::string name;
+    std::string identifier;
+    SPFR::ParameterType type;
+    std::string initial;        // Initial value as C++ expression.
+    std::size_t line;
+};
+
+bool is_keyword(const std::string &word)
+{
+    // The names of the members of the struct are reserved as well.
+    static const std::set<std::string> keywords = {
+        "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch",
+        "char", "char16_t", "char32_t", "class", "compl", "const", "const_cast", "constexpr", "continue", "decltype",
+        "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false",
+        "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept",
+        "not", "not_eq", "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register",
+        "reinterpret_cast", "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct",
+        "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union",
+        "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq", "load", "parse"};
+
+    return keywords.count(word) != 0;
+}
+
+/** Turns a parameter name like "motor.left-gain" into a field name like "motor_left_gain". */
+std::string make_identifier(const std::string &name)
+{
+    std::string identifier;
+
+    for (char c : name) identifier += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+
+    if (std::isdigit(static_cast<unsigned char>(identifier[0]))) identifier.insert(0, 1, '_');
+    if (is_keyword(identifier)) identifier += '_';
+
+    return identifier;
+}
+
+/** Character as C++ literal, characters which aren't printable as octal escapes. */
+std::string escape(char c, char quote)
+{
+    unsigned char u = static_cast<unsigned char>(c);
+
+    if (c == quote || c == '\\') return std::string("\\") + c;
+    if (std::isprint(u)) return std::string(1, c);
+
+    char octal[8];
+
+    std::snprintf(octal, sizeof(octal), "\\%03o", u);
+    return octal;
+}
+
+std::string literal(const std::string &text)
+{
+    std::string result = "\"";
+
+    for (char c : text) result += escape(c, '"');
+
+    return result + "\"";
+}
+
+std::string literal(char c) { return "'" + escape(c, '\'') + "'"; }
+std::string literal(bool value) { return value ? "true" : "false"; }
+
+std::string literal(int value)
+{
+    // The negative literal -2147483648 would be a long.
+    return value == std::numeric_limits<int>::min() ? "(-2147483647 - 1)" : std::to_string(value);
+}
+
+std::string literal(float value)
+{
+    char text[32];
+
+    // Nine digits give back the same float.
+    std::snprintf(text, sizeof(text), "%.9g", value);
+
+    std::string result = text;
+
+    if (result.find_first_of(".e") == std::string::npos) result += ".0";
+
+    return result + "f";
+}
+
+template <typename T>
+std::string literal(const std::vector<T> &values)
+{
+    std::string result = "{";
+
+    for (std::size_t i = 0; i < values.size(); i++) result += (i ? ", " : "") + literal(values[i]);
+
+    return result + "}";
+}
+
+/** Converts the value of the template to the type. @return False if it doesn't fit. */
+template <typename T>
+bool initial_value(std::string_view text, std::string &initial)
+{
+    T value{};
+
+    if (!SPFR::parse_value(text, value)) return false;
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (!std::isfinite(value)) return false;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<float>>)
+    {
+        for (float field : value) if (!std::isfinite(field)) return false;
+    }
+
+    initial = literal(value);
+    return true;
+}
+
+bool initial_value(SPFR::ParameterType type, std::string_view text, std::string &initial)
+{
+    switch (type)
+    {
+    case SPFR::ParameterType::String:       return initial_value<std::string>(text, initial);
+    case SPFR::ParameterType::Char:         return initial_value<char>(text, initial);
+    case SPFR::ParameterType::Int:          return initial_value<int>(text, initial);
+    case SPFR::ParameterType::Float:        return initial_value<float>(text, initial);
+    case SPFR::ParameterType::Bool:         return initial_value<bool>(text, initial);
+    case SPFR::ParameterType::IntArray:     return initial_value<std::vector<int>>(text, initial);
+    case SPFR::ParameterType::FloatArray:   return initial_value<std::vector<float>>(text, initial);
+    case SPFR::ParameterType::CharArray:    return initial_value<std::vector<char>>(text, initial);
+    case SPFR::ParameterType::StringArray:  return initial_value<std::vector<std::string>>(text, initial);
+    }
+
+    return false;
+}
+
+const char *cpp_type(SPFR::ParameterType type)
+{
+    static const char *const names[SPFR::parameter_type_count] = {"std::string", "char", "int", "float", "bool",
+                                                                  "std::vector<int>", "std::vector<float>",
+                                                                  "std::vector<char>", "std::vector<std::string>"};
+
+    return names[static_cast<std::size_t>(type)];
+}
+
+/** Type of a value without annotation. The narrowest type which reads the value wins, "1" is therefore an int. */
+SPFR::ParameterType infer_type(std::string_view text)
+{
+    using SPFR::ParameterType;
+
+    std::string initial;
+    bool array = !text.empty() && (text[0] == '[' || text[0] == '(' || text[0] == '{');
+
+    if (array)
+    {
+        for (ParameterType type : {ParameterType::IntArray, ParameterType::FloatArray, ParameterType::CharArray})
+        {
+            if (initial_value(type, text, initial)) return type;
+        }
+
+        return ParameterType::StringArray;
+    }
+
+    for (ParameterType type : {ParameterType::Int, ParameterType::Float, ParameterType::Bool, ParameterType::Char})
+    {
+        if (initial_value(type, text, initial)) return type;
+    }
+
+    return ParameterType::String;
+}
+
+/** Finds "@type NAME" in a comment. @return False if the comment has an unknown type. */
+bool read_annotation(std::string_view comment, std::string &type_name)
+{
+    std::size_t at = comment.find("@type");
+
+    if (at == std::string_view::npos) return true;
+
+    std::istringstream words(std::string(comment.substr(at + 5)));
+
+    words >> type_name;
+    return !type_name.empty();
+}
+
+bool parse_template(const std::string &file_name, std::vector<Parameter> &parameters, std::string &error)
+{
+    std::ifstream file(file_name, std::ios::binary);
+
+    if (!file)
+    {
+        error = "Cannot open the template " + file_name + ".";
+        return false;
+    }
+
+    std::string line;
+    std::string pending_type;
+    std::size_t line_number = 0;
+    std::map<std::string, std::size_t> identifiers;        // Field names and their parameters.
+
+    while (std::getline(file, line))
+    {
+        line_number++;
+
+        std::string at = file_name + ":" + std::to_string(line_number) + ": ";
+        std::size_t comment = line.find('#');
+        std::string type_name;
+
+        if (comment != std::string::npos && !read_annotation(std::string_view(line).substr(comment), type_name))
+        {
+            error = at + "The annotation @type has no type.";
+            return false;
+        }
+
+        // The line is split by the same rules as a configuration file.
+        std::pmr::vector<std::string_view> tokens;
+        std::pmr::deque<std::pmr::string> spill;
+
+        SPFR::tokenize_config(line.data(), line.size(), tokens, spill);
+
+        if (tokens.empty())
+        {
+            // A comment line annotates the next parameter.
+            if (!type_name.empty()) pending_type = type_name;
+
+            continue;
+        }
+
+        if (tokens.size() != 2)
+        {
+            error = at + "A line of a template needs exactly one name and one value.";
+            return false;
+        }
+
+        Parameter parameter;
+
+        parameter.name = std::string(tokens[0]);
+        parameter.line = line_number;
+
+        if (parameter.name == "@include")
+        {
+            error = at + "A template can't include other files.";
+            return false;
+        }
+
+        if (type_name.empty()) type_name = pending_type;
+
+        pending_type.clear();
+
+        if (type_name.empty())
+        {
+            parameter.type = infer_type(tokens[1]);
+        }
+        else
+        {
+            std::size_t type = 0;
+
+            while (type < SPFR::parameter_type_count &&
+                   type_name != SPFR::ConfigSchema::type_name(static_cast<SPFR::ParameterType>(type))) type++;
+
+            if (type == SPFR::parameter_type_count)
+            {
+                error = at + "The type " + type_name + " is unknown.";
+                return false;
+            }
+
+            parameter.type = static_cast<SPFR::ParameterType>(type);
+        }
+
+        // The value of the template has to fit its type, otherwise the struct would have a wrong initial value.
+        if (!initial_value(parameter.type, tokens[1], parameter.initial))
+        {
+            error = at + "The value " + std::string(tokens[1]) + " of " + parameter.name + " isn't a valid " +
+                    SPFR::ConfigSchema::type_name(parameter.type) + ".";
+            return false;
+        }
+
+        parameter.identifier = make_identifier(parameter.name);
+
+        auto inserted = identifiers.emplace(parameter.identifier, parameters.size());
+
+        if (!inserted.second)
+        {
+            const Parameter &other = parameters[inserted.first->second];
+
+            error = at + "The parameter " + parameter.name + (other.name == parameter.name ? " is already declared" :
+                    " has the same field name " + parameter.identifier + " as " + other.name) + " in line " +
+                    std::to_string(other.line) + ".";
+            return false;
+        }
+
+        parameters.push_back(parameter);
+    }
+
+    if (!pending_type.empty())
+    {
+        error = file_name + ": The annotation @type " + pending_type + " has no parameter after it.";
+        return false;
+    }
+
+    if (parameters.empty())
+    {
+        error = "The template " + file_name + " has no parameters.";
+        return false;
+    }
+
+    return true;
+}
+
+void write_read(std::ostream &out, const Parameter &parameter, std::size_t number, const char *indent)
+{
+    out << indent << "if (name == " << literal(parameter.name) << " && !seen[" << number << "])\n"
+        << indent << "{\n"
+        << indent << "    seen[" << number << "] = true;\n"
+        << indent << "    SPFR::read_field(tokens.value(i), this->" << parameter.identifier << ", "
+        << literal(parameter.name) << ", summary);\n"
+        << indent << "}\n";
+}
+
+void write_header(std::ostream &out, const std::vector<Parameter> &parameters, const std::string &struct_name,
+                  const std::string &template_name)
+{
+    std::string guard = "SPFR_GENERATED_";
+
+    for (char c : struct_name) guard += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+    out << "// Generated by SPFR_generate from " << template_name << ". Don't edit, generate it again.\n\n"
+        << "#ifndef " << guard << "_HPP\n"
+        << "#define " << guard << "_HPP\n\n"
+        << "#include <cstddef>\n#include <string>\n#include <string_view>\n#include <vector>\n\n"
+        << "#include \"configStruct.hpp\"\n\n\n"
+        << "struct " << struct_name << "\n{\n";
+
+    for (const Parameter &parameter : parameters)
+    {
+        out << "        " << cpp_type(parameter.type) << " " << parameter.identifier << " = " << parameter.initial
+            << ";\n";
+    }
+
+    out << "\n"
+        << "        /** Reads the file. @return False if it can't be read, the summary tells about the parameters. */\n"
+        << "        bool load(const std::string &file_name, SPFR::BindSummary &summary, std::string &error)\n"
+        << "        {\n"
+        << "            SPFR::ConfigTokens tokens;\n\n"
+        << "            if (!tokens.open(file_name, error)) return false;\n\n"
+        << "            summary = this->parse(tokens);\n"
+        << "            return true;\n"
+        << "        }\n\n"
+        << "        /** Fills the fields from the tokens, the first value of a name wins. */\n"
+        << "        SPFR::BindSummary parse(const SPFR::ConfigTokens &tokens)\n"
+        << "        {\n"
+        << "            static const char *const names[] = {";
+
+    for (std::size_t i = 0; i < parameters.size(); i++)
+    {
+        out << (i ? "," : "") << (i % 4 == 0 ? "\n                " : " ") << literal(parameters[i].name);
+    }
+
+    out << "};\n\n"
+        << "            SPFR::BindSummary summary;\n"
+        << "            bool seen[" << parameters.size() << "] = {};\n\n"
+        << "            for (std::size_t i = 0; i < tokens.size(); i++)\n"
+        << "            {\n"
+        << "                std::string_view name = tokens.name(i);\n\n"
+        << "                switch (name.size())\n"
+        << "                {\n";
+
+    std::map<std::size_t, std::vector<std::size_t>> by_length;
+
+    for (std::size_t i = 0; i < parameters.size(); i++) by_length[parameters[i].name.size()].push_back(i);
+
+    for (const auto &length : by_length)
+    {
+        out << "                case " << length.first << ":\n";
+
+        // The hashes of the names of one length have to differ for the cases of the switch.
+        std::set<std::uint64_t> hashes;
+
+        for (std::size_t i : length.second) hashes.insert(SPFR::KeyIndex::hash(parameters[i].name));
+
+        if (length.second.size() <= max_compares || hashes.size() < length.second.size())
+        {
+            for (std::size_t i : length.second) write_read(out, parameters[i], i, "                    ");
+        }
+        else
+        {
+            out << "                    switch (SPFR::KeyIndex::hash(name))\n"
+                << "                    {\n";
+
+            for (std::size_t i : length.second)
+            {
+                out << "                    case SPFR::KeyIndex::hash(" << literal(parameters[i].name) << "):\n";
+                write_read(out, parameters[i], i, "                        ");
+                out << "                        break;\n";
+            }
+
+            out << "                    default:\n"
+                << "                        break;\n"
+                << "                    }\n";
+        }
+
+        out << "                    break;\n";
+    }
+
+    out << "                default:\n"
+        << "                    break;\n"
+        << "                }\n"
+        << "            }\n\n"
+        << "            for (std::size_t i = 0; i < " << parameters.size() << "; i++)\n"
+        << "            {\n"
+        << "                if (!seen[i]) summary.missing.push_back(names[i]);\n"
+        << "            }\n\n"
+        << "            return summary;\n"
+        << "        }\n"
+        << "};\n\n"
+        << "#endif // " << guard << "_HPP\n";
+}
+
+bool is_identifier(const std::string &name)
+{
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) return false;
+
+    for (char c : name)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') return false;
+    }
+
+    return true;
+}
+
+}
+
+
+int main (int argc, char *argv[])
+{
+    if (argc != 4)
+    {
+        std::fprintf(stderr, "Usage: %s TEMPLATE_FILE STRUCT_NAME HEADER_FILE\n", argv[0]);
+        return 2;
+    }
+
+    std::string struct_name = argv[2];
+
+    if (!is_identifier(struct_name))
+    {
+        std::fprintf(stderr, "Error: %s is no valid name for a struct.\n", argv[2]);
+        return 2;
+    }
+
+    std::string error;
+    std::vector<Parameter> parameters;
+
+    if (!parse_template(argv[1], parameters, error))
+    {
+        std::fprintf(stderr, "Error while generating %s: %s\n", argv[3], error.c_str());
+        return 1;
+    }
+
+    // The header is written into memory first, so a build never sees half of it.
+    std::ostringstream header;
+
+    write_header(header, parameters, struct_name, argv[1]);
+
+    std::ofstream file(argv[3], std::ios::binary | std::ios::trunc);
+
+    if (!(file << header.str()) || !file.flush())
+    {
+        std::fprintf(stderr, "Error while writing %s.\n", argv[3]);
+        return 1;
+    }
+
+    std::printf("Generated %s with %zu parameters of %s in %s.\n", struct_name.c_str(), parameters.size(), argv[1],
+                argv[3]);
+
+    return 0;
+}